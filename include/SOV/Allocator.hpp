@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Descriptor.hpp"
+
+namespace SOV {
+	namespace Descriptor {
+		// Allocates sets from a chain of pools, adding a pool when the current ones are exhausted.
+		// Sets are released together by Reset, typically with one allocator per frame in flight.
+		class Allocator {
+		public:
+			struct Info {
+				// Descriptors per set, a pool holds these times its set count.
+				ACTL::Array<Pool::Size> sizesPerSet;
+
+				unsigned initialSetCount = 64;
+
+				unsigned maxSetCount = 4096;
+			};
+
+			const SOV::Device& Device;
+
+			Allocator(const Allocator&) = delete;
+
+			Allocator& operator =(const Allocator&) = delete;
+
+			Allocator(const SOV::Device& Device, const Info& info) : Device(Device), info(info), nextSetCount(info.initialSetCount) {};
+
+			Set Allocate(const Set::Layout& SetLayout);
+
+			// Invalidates all allocated sets. If more than one pool was needed, they are replaced by a single larger one.
+			void Reset();
+
+			unsigned GetPoolCount() const {
+				return (unsigned)Pools.GetLength();
+			}
+
+		private:
+			Info info;
+
+			ACTL::Array<Pool> Pools;
+
+			unsigned current = 0;
+
+			// Sets allocated since the last reset.
+			unsigned setCount = 0;
+
+			unsigned firstSetCount = 0;
+
+			unsigned lastSetCount = 0;
+
+			unsigned nextSetCount;
+
+			void AddPool();
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Submission.hpp"
+
+namespace SOV {
+	// Spreads independent submissions across all created queues of a family, picking the queue with the least outstanding
+	// submissions. Each queue signals its own timeline, which tracks load and completion. Not thread-safe.
+	class Queue::Balancer {
+	public:
+		struct Ticket {
+			unsigned queue;
+
+			ACTL::u64 value;
+		};
+
+		static constexpr unsigned noStream = ~0u;
+
+		const SOV::Device& Device;
+
+		const Family& family;
+
+		Balancer(const Balancer&) = delete;
+
+		Balancer& operator =(const Balancer&) = delete;
+
+		// Submissions of the same stream execute in order, each waits for the previous one. Streams are numbered below
+		// streamCount.
+		Balancer(const SOV::Device& Device, const Family& family, unsigned streamCount);
+
+		~Balancer() {};
+
+		// Signals the queue's timeline from the last submission of Batch, submits and clears it.
+		Ticket Submit(Batch& Batch, unsigned stream);
+
+		Ticket Submit(const Command::Buffer& Buffer, unsigned stream);
+
+		bool isComplete(const Ticket& ticket) const {
+			return Timelines[ticket.queue].GetValue() >= ticket.value;
+		}
+
+		// Returns false on timeout.
+		bool Wait(const Ticket& ticket, ACTL::u64 timeout) const {
+			return Timelines[ticket.queue].Wait(ticket.value, timeout);
+		}
+
+		// Number of submissions still executing on a queue.
+		ACTL::u64 GetLoad(unsigned queue) const {
+			return values[queue] - Timelines[queue].GetValue();
+		}
+
+	private:
+		const ACTL::Array<Queue>& Queues;
+
+		ACTL::Array<Semaphore> Timelines;
+
+		ACTL::Array<ACTL::u64> values;
+
+		// Last ticket of each stream.
+		ACTL::Array<Ticket> streams;
+
+		// Used by the command buffer overload.
+		SOV::Queue::Batch BufferBatch;
+
+		unsigned SelectQueue(unsigned stream) const;
+	};
+}
\ No newline at end of file
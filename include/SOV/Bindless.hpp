@@ -0,0 +1,111 @@
+#pragma once
+
+#include <mutex>
+
+#include "Descriptor.hpp"
+#include "Image.hpp"
+#include "Buffer.hpp"
+
+namespace SOV {
+	namespace Descriptor {
+		// One update-after-bind set with arrays of sampled images (binding 0), storage buffers (binding 1) and samplers (binding 2).
+		// Shaders index the arrays with handles, so draws need no per-draw sets. Needs VK_EXT_descriptor_indexing with
+		// partially bound bindings and update after bind for sampled images and storage buffers.
+		class Bindless {
+		public:
+			enum Kind {
+				SAMPLED_IMAGE,
+				STORAGE_BUFFER,
+				SAMPLER,
+			};
+
+			static constexpr unsigned kindCount = 3;
+
+			// Index into the array of its kind.
+			using Handle = unsigned;
+
+			static constexpr Handle invalid = ~0u;
+
+			// Counts above the device's update-after-bind limits are lowered to them.
+			struct Info {
+				unsigned sampledImageCount = 16384;
+
+				unsigned storageBufferCount = 16384;
+
+				unsigned samplerCount = 256;
+
+				Shader::StageFlag shaderStageFlags = Shader::ALL;
+			};
+
+			const SOV::Device& Device;
+
+			Bindless(const Bindless&) = delete;
+
+			Bindless& operator =(const Bindless&) = delete;
+
+			Bindless(const SOV::Device& Device, const Info& info);
+
+			~Bindless() {};
+
+			Handle AddImage(const Image::View& View, Image::Layout layout);
+
+			Handle AddBuffer(const Buffer& Buffer, SOV::size offset, SOV::size range);
+
+			Handle AddSampler(const Sampler& Sampler);
+
+			// The handle may be returned by the next add, remove only once no submitted work uses it. Throws for handles which
+			// were never added and, in debug builds, for handles removed twice.
+			void Remove(Kind kind, Handle handle);
+
+			// Counts after clamping to the device limits.
+			const Info& getInfo() const {
+				return info;
+			}
+
+			const Set::Layout& getLayout() const {
+				return SetLayout;
+			}
+
+			operator VkDescriptorSet() const {
+				return Sets[0];
+			}
+
+			operator bool() const {
+				return Sets;
+			}
+
+		private:
+			struct Slots {
+				unsigned capacity = 0;
+
+				unsigned next = 0;
+
+				ACTL::Array<Handle> free;
+			};
+
+			Slots slots[kindCount];
+
+			std::mutex mutex;
+
+			Info info;
+
+			Set::Layout SetLayout;
+
+			Pool DescriptorPool;
+
+			Set::Array Sets;
+
+			// Throws if the descriptors of all kinds together exceed the per stage limit.
+			static Info Clamp(const SOV::Device& Device, const Info& info);
+
+			static ACTL::Array<Set::Layout::Binding> GetBindings(const SOV::Device& Device, const Info& info);
+
+			static Pool::Info GetPoolInfo(const Info& info);
+
+			// Call with mutex locked.
+			Handle Acquire(Kind kind);
+
+			Handle Write(Kind kind, const VkDescriptorImageInfo* vkImageInfo, const VkDescriptorBufferInfo* vkBufferInfo);
+		};
+	}
+}
\ No newline at end of file
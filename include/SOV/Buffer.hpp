@@ -16,6 +16,7 @@ namespace SOV {
 			VERTEX_BUFFER         = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
 			INDIRECT_BUFFER       = VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
 			SHADER_DEVICE_ADDRESS = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+			CONDITIONAL_RENDERING = VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT,
 		};
 
 		struct ImageCopyInfo {
@@ -40,6 +41,39 @@ namespace SOV {
 			SOV::size size;
 		};
 
+		// Layout of VkDrawIndirectCommand.
+		struct DrawIndirectInfo {
+			unsigned vertexCount;
+
+			unsigned instanceCount;
+
+			unsigned firstVertex;
+
+			unsigned firstInstance;
+		};
+
+		// Layout of VkDrawIndexedIndirectCommand.
+		struct DrawIndexedIndirectInfo {
+			unsigned indexCount;
+
+			unsigned instanceCount;
+
+			unsigned firstIndex;
+
+			int vertexOffset;
+
+			unsigned firstInstance;
+		};
+
+		// Layout of VkDispatchIndirectCommand.
+		struct DispatchIndirectInfo {
+			unsigned groupCountX;
+
+			unsigned groupCountY;
+
+			unsigned groupCountZ;
+		};
+
 		struct Info {
 			SOV::size size;
 
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+
+#include "Submission.hpp"
+
+namespace SOV {
+	// Lock-free multi-producer single-consumer submission channel of a queue. Any thread may Push,
+	// one thread at a time drains everything pushed so far with a single vkQueueSubmit2.
+	class Queue::Channel {
+	public:
+		// Completion token, the channel's timeline reaches it once the submission has finished executing.
+		using Token = ACTL::u64;
+
+		struct Submission {
+			Command::Buffer Buffer;
+
+			// Optional semaphore to wait on, value is ignored for binary semaphores.
+			const Semaphore* Wait = nullptr;
+
+			ACTL::u64 waitValue = 0;
+
+			Pipeline::StageFlag waitStages = Pipeline::ALL_COMMANDS;
+
+			// Optional semaphore to signal besides the channel's timeline.
+			const Semaphore* Signal = nullptr;
+
+			ACTL::u64 signalValue = 0;
+		};
+
+		const SOV::Queue& Queue;
+
+		Channel(const Channel&) = delete;
+
+		Channel& operator =(const Channel&) = delete;
+
+		Channel(const SOV::Device& Device, const SOV::Queue& Queue) : Queue(Queue), Timeline(Device, Semaphore::Type::TIMELINE, 0) {};
+
+		// Drops submissions which were pushed but not drained.
+		~Channel();
+
+		// Thread-safe and lock-free.
+		Token Push(const Submission& submission);
+
+		// Submits pushed submissions in token order and returns their count. Must not be called concurrently.
+		unsigned Drain();
+
+		bool isComplete(Token token) const {
+			return Timeline.GetValue() >= token;
+		}
+
+		// Returns false on timeout.
+		bool Wait(Token token, ACTL::u64 timeout) const {
+			return Timeline.Wait(token, timeout);
+		}
+
+		const Semaphore& getTimeline() const {
+			return Timeline;
+		}
+
+	private:
+		struct Node {
+			Submission submission;
+
+			Token token;
+
+			Node* next;
+		};
+
+		Semaphore Timeline;
+
+		std::atomic<Node*> head = nullptr;
+
+		std::atomic<Token> lastToken = 0;
+
+		// Consumer side only.
+		Token lastSubmitted = 0;
+
+		ACTL::Array<Node*> pending;
+
+		SOV::Queue::Batch Batch;
+	};
+}
\ No newline at end of file
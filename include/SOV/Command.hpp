@@ -2,6 +2,8 @@
 
 #include "Buffer.hpp"
 #include "Descriptor.hpp"
+#include "Query.hpp"
+#include "Pipeline.hpp"
 #include "Sync.hpp"
 
 namespace SOV {
@@ -48,6 +50,20 @@ namespace SOV {
 
 			friend Array;
 			
+			struct MultiDrawInfo {
+				unsigned firstVertex;
+
+				unsigned vertexCount;
+			};
+
+			struct MultiDrawIndexedInfo {
+				unsigned firstIndex;
+
+				unsigned indexCount;
+
+				int vertexOffset;
+			};
+
 			enum UsageFlag {
 				NONE                 = 0,
 				ONE_TIME_SUBMIT      = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
@@ -138,6 +154,299 @@ namespace SOV {
 				);
 			}
 
+			void DrawIndirect(
+				const SOV::Buffer& Buffer,
+				SOV::size offset,
+				unsigned drawCount,
+				unsigned stride
+			) const {
+				vkCmdDrawIndirect(
+					vkBuffer,
+					Buffer,
+					offset,
+					drawCount,
+					stride
+				);
+			}
+
+			// Throws if the drawIndirectCount feature is not enabled.
+			void DrawIndirectCount(
+				const SOV::Device& Device,
+				const SOV::Buffer& Buffer,
+				SOV::size offset,
+				const SOV::Buffer& CountBuffer,
+				SOV::size countOffset,
+				unsigned maxDrawCount,
+				unsigned stride
+			) const;
+
+			// Throws if the drawIndirectCount feature is not enabled.
+			void DrawIndexedIndirectCount(
+				const SOV::Device& Device,
+				const SOV::Buffer& Buffer,
+				SOV::size offset,
+				const SOV::Buffer& CountBuffer,
+				SOV::size countOffset,
+				unsigned maxDrawCount,
+				unsigned stride
+			) const;
+
+			// Requires VK_EXT_multi_draw and its multiDraw feature.
+			void DrawMulti(
+				const SOV::Device& Device,
+				const ACTL::Array<MultiDrawInfo>& draws,
+				unsigned instanceCount,
+				unsigned firstInstance
+			) const;
+
+			// Requires VK_EXT_multi_draw and its multiDraw feature.
+			void DrawMultiIndexed(
+				const SOV::Device& Device,
+				const ACTL::Array<MultiDrawIndexedInfo>& draws,
+				unsigned instanceCount,
+				unsigned firstInstance
+			) const;
+
+			void BindPipeline(Pipeline::BindPoint bindPoint, VkPipeline vkPipeline) const {
+				vkCmdBindPipeline(vkBuffer, (VkPipelineBindPoint)bindPoint, vkPipeline);
+			}
+
+			void BindDescriptorSets(
+				Pipeline::BindPoint bindPoint,
+				VkPipelineLayout vkLayout,
+				unsigned firstSet,
+				const Descriptor::Set& Set
+			) const {
+				VkDescriptorSet vkSet = Set;
+
+				vkCmdBindDescriptorSets(
+					vkBuffer,
+					(VkPipelineBindPoint)bindPoint,
+					vkLayout,
+					firstSet,
+					1,
+					&vkSet,
+					0,
+					nullptr
+				);
+			}
+
+			void BindDescriptorSets(
+				Pipeline::BindPoint bindPoint,
+				VkPipelineLayout vkLayout,
+				unsigned firstSet,
+				const ACTL::Array<Descriptor::Set>& Sets
+			) const {
+				vkCmdBindDescriptorSets(
+					vkBuffer,
+					(VkPipelineBindPoint)bindPoint,
+					vkLayout,
+					firstSet,
+					(unsigned)Sets.GetLength(),
+					(const VkDescriptorSet*)Sets.begin(),
+					0,
+					nullptr
+				);
+			}
+
+			void BindDescriptorSets(
+				Pipeline::BindPoint bindPoint,
+				VkPipelineLayout vkLayout,
+				unsigned firstSet,
+				const ACTL::Array<Descriptor::Set>& Sets,
+				const ACTL::Array<unsigned>& dynamicOffsets
+			) const {
+				vkCmdBindDescriptorSets(
+					vkBuffer,
+					(VkPipelineBindPoint)bindPoint,
+					vkLayout,
+					firstSet,
+					(unsigned)Sets.GetLength(),
+					(const VkDescriptorSet*)Sets.begin(),
+					(unsigned)dynamicOffsets.GetLength(),
+					dynamicOffsets.begin()
+				);
+			}
+
+			void PushConstants(
+				VkPipelineLayout vkLayout,
+				Shader::StageFlag shaderStageFlags,
+				unsigned offset,
+				unsigned size,
+				const void* data
+			) const {
+				vkCmdPushConstants(
+					vkBuffer,
+					vkLayout,
+					(VkShaderStageFlags)shaderStageFlags,
+					offset,
+					size,
+					data
+				);
+			}
+
+			// Throws if Type does not fit the push constant ranges of Layout.
+			template <typename Type>
+			void PushConstants(const Pipeline::Layout& Layout, Shader::StageFlag shaderStageFlags, unsigned offset, const Type& data) const {
+				static_assert(sizeof(Type) % 4 == 0, "Push constant size must be a multiple of 4.");
+
+				if (!Layout.CoversPushConstants(shaderStageFlags, offset, sizeof(Type)))
+					throw Exception("Push constants do not fit the pipeline layout.", this, Exception::Type::OTHER);
+
+				PushConstants(Layout, shaderStageFlags, offset, sizeof(Type), &data);
+			}
+
+			// Needs VK_KHR_push_descriptor, the set layout is created with PUSH_DESCRIPTOR. dstSet of writes is ignored.
+			void PushDescriptorSet(
+				const SOV::Device& Device,
+				Pipeline::BindPoint bindPoint,
+				VkPipelineLayout vkLayout,
+				unsigned set,
+				unsigned writeCount,
+				const VkWriteDescriptorSet* vkWrites
+			) const;
+
+			// Template is created for push descriptors. Throws if Type is smaller than the data read by Template.
+			template <typename Type>
+			void PushDescriptorSet(const Descriptor::Template& Template, VkPipelineLayout vkLayout, unsigned set, const Type& data) const {
+				if (sizeof(Type) < Template.getDataSize())
+					throw Exception("Descriptor data is smaller than the template reads.", this, Exception::Type::OTHER);
+
+				PushDescriptorSet(Template, vkLayout, set, (const void*)&data);
+			}
+
+			void PushDescriptorSet(const Descriptor::Template& Template, VkPipelineLayout vkLayout, unsigned set, const void* data) const;
+
+			void Dispatch(
+				unsigned groupCountX,
+				unsigned groupCountY,
+				unsigned groupCountZ
+			) const {
+				vkCmdDispatch(
+					vkBuffer,
+					groupCountX,
+					groupCountY,
+					groupCountZ
+				);
+			}
+
+			void DispatchBase(
+				unsigned baseGroupX,
+				unsigned baseGroupY,
+				unsigned baseGroupZ,
+				unsigned groupCountX,
+				unsigned groupCountY,
+				unsigned groupCountZ
+			) const {
+				vkCmdDispatchBase(
+					vkBuffer,
+					baseGroupX,
+					baseGroupY,
+					baseGroupZ,
+					groupCountX,
+					groupCountY,
+					groupCountZ
+				);
+			}
+
+			void DispatchIndirect(
+				const SOV::Buffer& Buffer,
+				SOV::size offset
+			) const {
+				vkCmdDispatchIndirect(
+					vkBuffer,
+					Buffer,
+					offset
+				);
+			}
+
+			void ResetQueryPool(
+				const Query::Pool& Pool,
+				unsigned firstQuery,
+				unsigned queryCount
+			) const {
+				vkCmdResetQueryPool(
+					vkBuffer,
+					Pool,
+					firstQuery,
+					queryCount
+				);
+			}
+
+			void WriteTimestamp(
+				Pipeline::StageFlag stageFlag,
+				const Query::Pool& Pool,
+				unsigned query
+			) const {
+				vkCmdWriteTimestamp(
+					vkBuffer,
+					(VkPipelineStageFlagBits)stageFlag,
+					Pool,
+					query
+				);
+			}
+
+			// Throws for Query::PRECISE if the occlusionQueryPrecise feature is not enabled.
+			void BeginQuery(
+				const Query::Pool& Pool,
+				unsigned query,
+				Query::ControlFlag controlFlags
+			) const {
+				if ((controlFlags & Query::PRECISE) && !Pool.Device.getFeatures().occlusionQueryPrecise)
+					throw Exception("occlusionQueryPrecise feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+				vkCmdBeginQuery(
+					vkBuffer,
+					Pool,
+					query,
+					(VkQueryControlFlags)controlFlags
+				);
+			}
+
+			void EndQuery(
+				const Query::Pool& Pool,
+				unsigned query
+			) const {
+				vkCmdEndQuery(
+					vkBuffer,
+					Pool,
+					query
+				);
+			}
+
+			// Resolves results on the GPU. With Query::WAIT the copy waits for availability on the device, not on the host.
+			void CopyQueryPoolResults(
+				const Query::Pool& Pool,
+				unsigned firstQuery,
+				unsigned queryCount,
+				const SOV::Buffer& Destination,
+				SOV::size offset,
+				SOV::size stride,
+				Query::ResultFlag resultFlags
+			) const {
+				vkCmdCopyQueryPoolResults(
+					vkBuffer,
+					Pool,
+					firstQuery,
+					queryCount,
+					Destination,
+					offset,
+					stride,
+					(VkQueryResultFlags)resultFlags
+				);
+			}
+
+			// Requires VK_EXT_conditional_rendering and its conditionalRendering feature.
+			// Commands until EndConditionalRendering are discarded if the 32-bit value at offset is zero (non-zero if inverted).
+			void BeginConditionalRendering(
+				const SOV::Device& Device,
+				const SOV::Buffer& Buffer,
+				SOV::size offset,
+				bool inverted
+			) const;
+
+			void EndConditionalRendering(const SOV::Device& Device) const;
+
 			void CopyBufferToImage(
 				const SOV::Buffer& Source,
 				const Image& Destination,
@@ -153,6 +462,84 @@ namespace SOV {
 				);
 			}
 
+			void PipelineBarrier(
+				Pipeline::StageFlag srcStageFlags,
+				AccessFlag srcAccessFlags,
+				Pipeline::StageFlag dstStageFlags,
+				AccessFlag dstAccessFlags
+			) const {
+				VkMemoryBarrier vkBarrier = {
+					.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+					.srcAccessMask = (VkAccessFlags)srcAccessFlags,
+					.dstAccessMask = (VkAccessFlags)dstAccessFlags,
+				};
+
+				vkCmdPipelineBarrier(
+					vkBuffer,
+					(VkPipelineStageFlags)srcStageFlags,
+					(VkPipelineStageFlags)dstStageFlags,
+					0,
+					1,
+					&vkBarrier,
+					0,
+					nullptr,
+					0,
+					nullptr
+				);
+			}
+
+			// Signal half of a split barrier. The dependency must match the one of the corresponding WaitEvent. Event commands
+			// require the synchronization2 feature.
+			void SetEvent(
+				const Event& Event,
+				Pipeline::StageFlag srcStageFlags,
+				AccessFlag srcAccessFlags,
+				Pipeline::StageFlag dstStageFlags,
+				AccessFlag dstAccessFlags
+			) const;
+
+			void ResetEvent(const Event& Event, Pipeline::StageFlag stageFlags) const;
+
+			// Work recorded between SetEvent and WaitEvent can overlap with the producer.
+			void WaitEvent(
+				const Event& Event,
+				Pipeline::StageFlag srcStageFlags,
+				AccessFlag srcAccessFlags,
+				Pipeline::StageFlag dstStageFlags,
+				AccessFlag dstAccessFlags
+			) const;
+
+			void UpdateBuffer(
+				const SOV::Buffer& Destination,
+				SOV::size offset,
+				SOV::size size,
+				const void* data
+			) const {
+				vkCmdUpdateBuffer(
+					vkBuffer,
+					Destination,
+					offset,
+					size,
+					data
+				);
+			}
+
+			// Used to reset GPU written counters, such as indirect draw count, before a pass writes them.
+			void FillBuffer(
+				const SOV::Buffer& Destination,
+				SOV::size offset,
+				SOV::size size,
+				unsigned data
+			) const {
+				vkCmdFillBuffer(
+					vkBuffer,
+					Destination,
+					offset,
+					size,
+					data
+				);
+			}
+
 			void CopyBuffer(
 				const SOV::Buffer& Source,
 				const SOV::Buffer& Destination,
@@ -171,6 +558,16 @@ namespace SOV {
 			VkCommandBuffer vkBuffer;
 
 			Buffer(VkCommandBuffer vkBuffer) : vkBuffer(vkBuffer) {};
+
+			// Records the signal or the wait half of a split barrier with the same dependency.
+			void RecordEvent(
+				const Event& Event,
+				bool wait,
+				Pipeline::StageFlag srcStageFlags,
+				AccessFlag srcAccessFlags,
+				Pipeline::StageFlag dstStageFlags,
+				AccessFlag dstAccessFlags
+			) const;
 		};
 
 		class Buffer::Array {
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <unordered_map>
+
+#include "Pipeline.hpp"
+#include "Scheduler.hpp"
+
+namespace SOV {
+	namespace Pipeline {
+		// Compiles pipelines on the jobs of a Scheduler. Identical requests share one compilation and one pipeline, layouts are
+		// compared by content so a destroyed layout's reused handle never matches. Pipelines live as long as the compiler.
+		class Compiler {
+		public:
+			class Handle;
+
+			const SOV::Device& Device;
+
+			Compiler(const Compiler&) = delete;
+
+			Compiler& operator =(const Compiler&) = delete;
+
+			// Cache may be null.
+			Compiler(const SOV::Device& Device, SOV::Scheduler& Scheduler, const Pipeline::Cache* Cache) : Device(Device), Scheduler(Scheduler), Cache(Cache) {};
+
+			// Waits for compilations in flight.
+			~Compiler();
+
+			// Module and Layout must outlive the compilation.
+			Handle Compile(const Shader::Module& Module, const Layout& Layout);
+
+			// Module and Layout must outlive the compilation.
+			Handle Compile(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout);
+
+			// Modules and Layout must outlive the compilation.
+			Handle Compile(const Graphics::Info& info, const Layout& Layout);
+
+		private:
+			struct Entry {
+				Key key;
+
+				std::atomic<VkPipeline> vkPipeline = nullptr;
+
+				std::atomic<bool> failed = false;
+
+				Compute* ComputePipeline = nullptr;
+
+				Graphics* GraphicsPipeline = nullptr;
+			};
+
+			SOV::Scheduler& Scheduler;
+
+			const Pipeline::Cache* Cache;
+
+			std::mutex mutex;
+
+			std::condition_variable condition;
+
+			std::unordered_multimap<ACTL::u64, Entry*> entries;
+
+			unsigned pendingCount = 0;
+
+			// Returns null if an identical request exists, found is then set to it.
+			Entry* Find(Key&& key, Entry*& found);
+
+			void Finish(Entry* entry, VkPipeline vkPipeline);
+		};
+
+		class Compiler::Handle {
+		public:
+			friend Compiler;
+
+			Handle() {};
+
+			bool isReady() const {
+				return entry && entry->vkPipeline.load(std::memory_order_acquire);
+			}
+
+			bool hasFailed() const {
+				return entry && entry->failed.load(std::memory_order_acquire);
+			}
+
+			// Returns Fallback until the pipeline is compiled.
+			VkPipeline Get(VkPipeline Fallback) const {
+				VkPipeline vkPipeline = entry ? entry->vkPipeline.load(std::memory_order_acquire) : nullptr;
+
+				return vkPipeline ? vkPipeline : Fallback;
+			}
+
+			operator bool() const {
+				return entry;
+			}
+
+		private:
+			const Entry* entry = nullptr;
+
+			Handle(const Entry* entry) : entry(entry) {};
+		};
+	}
+}
\ No newline at end of file
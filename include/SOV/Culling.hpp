@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Profiler.hpp"
+
+namespace SOV {
+	namespace Culling {
+		// Per object input of a culling pass, matches the Object struct of shaders/Cull.comp.
+		struct Object {
+			float center[3];
+
+			float radius;
+
+			unsigned indexCount;
+
+			unsigned firstIndex;
+
+			int vertexOffset;
+
+			unsigned firstInstance;
+		};
+
+		// World space planes (normals point inward) and column-major view-projection used for Hi-Z test.
+		struct Frustum {
+			float planes[6][4];
+
+			float viewProjection[16];
+		};
+
+		// Host reference of the frustum test. Writes one draw per visible object.
+		void Cull(
+			const Frustum& frustum,
+			const ACTL::Array<Object>& objects,
+			ACTL::Array<Buffer::DrawIndexedIndirectInfo>& draws
+		);
+
+		// Culls objects on the GPU and compacts survivors into an indirect draw buffer with a draw count.
+		class Pass {
+		public:
+			static constexpr unsigned groupSize = 64;
+
+			struct Info {
+				const SOV::Buffer* Objects;
+
+				const SOV::Buffer* Draws;
+
+				const SOV::Buffer* DrawCount;
+
+				unsigned maxDrawCount;
+
+				// Farthest depth pyramid. Optional, Module must be compiled with HI_Z defined when set. HiZSampler is required
+				// with it.
+				const Image::View* HiZ;
+
+				const SOV::Sampler* HiZSampler;
+
+				Extent2 hiZExtent;
+
+				// Optional.
+				const Pipeline::Cache* Cache;
+			};
+
+			const SOV::Device& Device;
+
+			Pass(const Pass&) = delete;
+
+			Pass& operator =(const Pass&) = delete;
+
+			// Throws if HiZ is set without HiZSampler.
+			Pass(const Shader::Module& Module, const Info& info);
+
+			~Pass() {};
+
+			// Must be recorded outside of a render pass.
+			void Record(const Command::Buffer& Buffer, const Frustum& frustum, unsigned objectCount) const;
+
+			void Draw(const Command::Buffer& Buffer) const {
+				Buffer.DrawIndexedIndirectCount(
+					Device,
+					*info.Draws,
+					0,
+					*info.DrawCount,
+					0,
+					info.maxDrawCount,
+					sizeof(SOV::Buffer::DrawIndexedIndirectInfo)
+				);
+			}
+
+			operator bool() const {
+				return Compute;
+			}
+
+		private:
+			const Info info;
+
+			SOV::Buffer ParamsBuffer;
+
+			SOV::Memory ParamsMemory;
+
+			Descriptor::Set::Layout SetLayout;
+
+			Descriptor::Pool DescriptorPool;
+
+			Descriptor::Set::Array Sets;
+
+			Pipeline::Layout Layout;
+
+			Pipeline::Compute Compute;
+
+			static const Info& Validate(const Info& info);
+
+			static ACTL::Array<Descriptor::Set::Layout::Binding> GetBindings(const Info& info);
+
+			static Descriptor::Pool::Info GetPoolInfo(const Info& info);
+
+			ACTL::Array<Descriptor::Set::Layout&> GetSetLayouts();
+
+			void WriteDescriptors();
+		};
+
+		// Compares the GPU pass against the host reference on the same objects, which must match the Objects buffer of Pass.
+		// The host time is added to the statistics of Profiler as "Culling CPU", the pass is recorded in a "Culling GPU" scope
+		// after Profiler.BeginFrame.
+		void Benchmark(
+			Profiler& Profiler,
+			const Pass& Pass,
+			const Command::Buffer& Buffer,
+			const Frustum& frustum,
+			const ACTL::Array<Object>& objects
+		);
+	}
+}
\ No newline at end of file
@@ -43,6 +43,12 @@ namespace SOV {
 		R32G32B32A32_UINT   = VK_FORMAT_R32G32B32A32_UINT,
 		R32G32B32A32_SINT   = VK_FORMAT_R32G32B32A32_SINT,
 		R32G32B32A32_SFLOAT = VK_FORMAT_R32G32B32A32_SFLOAT,
+		B8G8R8A8_UNORM      = VK_FORMAT_B8G8R8A8_UNORM,
+		B8G8R8A8_SRGB       = VK_FORMAT_B8G8R8A8_SRGB,
+		D16_UNORM           = VK_FORMAT_D16_UNORM,
+		D32_SFLOAT          = VK_FORMAT_D32_SFLOAT,
+		D24_UNORM_S8_UINT   = VK_FORMAT_D24_UNORM_S8_UINT,
+		D32_SFLOAT_S8_UINT  = VK_FORMAT_D32_SFLOAT_S8_UINT,
 	};
 
 	enum SampleCountFlag {
@@ -103,6 +109,7 @@ namespace SOV {
 		HOST_WRITE                     = VK_ACCESS_HOST_WRITE_BIT,
 		MEMORY_READ                    = VK_ACCESS_MEMORY_READ_BIT,
 		MEMORY_WRITE                   = VK_ACCESS_MEMORY_WRITE_BIT,
+		CONDITIONAL_RENDERING_READ     = VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT,
 	};
 
 	enum DependencyFlag {
@@ -134,6 +141,16 @@ namespace SOV {
 		}
 	};
 
+	// FNV-1a.
+	inline ACTL::u64 Hash(const void* data, size size) {
+		ACTL::u64 hash = 0xCBF29CE484222325;
+
+		for (SOV::size i = 0; i < size; i++)
+			hash = (hash ^ ((const unsigned char*)data)[i]) * 0x100000001B3;
+
+		return hash;
+	}
+
 	class Exception {
 	public:
 		enum Type {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Shader.hpp"
+#include "RenderPass.hpp"
 
 namespace SOV {
 	namespace Descriptor {
@@ -20,6 +21,12 @@ namespace SOV {
 
 		class Pool {
 		public:
+			enum Flag {
+				NONE                = 0,
+				FREE_DESCRIPTOR_SET = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+				UPDATE_AFTER_BIND   = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+			};
+
 			struct Size {
 				Descriptor::Type descriptorType;
 
@@ -30,6 +37,9 @@ namespace SOV {
 				unsigned maxSetCount;
 
 				ACTL::Array<Size> sizes;
+
+				// Without FREE_DESCRIPTOR_SET sets are only released by Reset, which makes allocation cheaper on many drivers.
+				Flag flags = FREE_DESCRIPTOR_SET;
 			};
 
 			const SOV::Device& Device;
@@ -40,7 +50,7 @@ namespace SOV {
 
 			Pool(const SOV::Device& Device, const Info& info);
 
-			Pool(Pool&& Other) noexcept : Device(Other.Device) {
+			Pool(Pool&& Other) noexcept : Device(Other.Device), flags(Other.flags) {
 				vkPool = Other.vkPool;
 
 				Other.vkPool = nullptr;
@@ -48,6 +58,13 @@ namespace SOV {
 
 			~Pool();
 
+			// Returns all sets to the pool.
+			void Reset();
+
+			Flag getFlags() const {
+				return flags;
+			}
+
 			operator VkDescriptorPool() const {
 				return vkPool;
 			}
@@ -58,6 +75,8 @@ namespace SOV {
 
 		private:
 			VkDescriptorPool vkPool = nullptr;
+
+			Flag flags;
 		};
 
 		class Set {
@@ -68,6 +87,10 @@ namespace SOV {
 
 			friend Array;
 
+			friend class Allocator;
+
+			Set() {};
+
 			Set(const Set& Other) {
 				operator=(Other);
 			}
@@ -104,7 +127,22 @@ namespace SOV {
 
 		class Set::Layout {
 		public:
+			enum Flag {
+				NONE                   = 0,
+				UPDATE_AFTER_BIND_POOL = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+				PUSH_DESCRIPTOR        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR,
+			};
+
 			struct Binding {
+				// Need the matching descriptor indexing features.
+				enum Flag {
+					NONE                        = 0,
+					UPDATE_AFTER_BIND           = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT,
+					UPDATE_UNUSED_WHILE_PENDING = VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT,
+					PARTIALLY_BOUND             = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT,
+					VARIABLE_DESCRIPTOR_COUNT   = VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT,
+				};
+
 				unsigned binding;
 
 				Descriptor::Type descriptorType;
@@ -112,6 +150,8 @@ namespace SOV {
 				unsigned descriptorCount;
 
 				Shader::StageFlag shaderStageFlags;
+
+				Flag flags = NONE;
 			};
 
 			const SOV::Device& Device;
@@ -120,9 +160,12 @@ namespace SOV {
 
 			Layout& operator =(const Layout&) = delete;
 
-			Layout(const SOV::Device& Device, const ACTL::Array<Binding>& bindings);
+			Layout(const SOV::Device& Device, const ACTL::Array<Binding>& bindings) : Layout(Device, bindings, NONE) {};
+
+			// Sets of an UPDATE_AFTER_BIND_POOL layout must come from an UPDATE_AFTER_BIND pool.
+			Layout(const SOV::Device& Device, const ACTL::Array<Binding>& bindings, Flag flags);
 
-			Layout(Layout&& Other) noexcept : Device(Other.Device) {
+			Layout(Layout&& Other) noexcept : Device(Other.Device), flags(Other.flags), bindings(ACTL::move(Other.bindings)) {
 				vkLayout = Other.vkLayout;
 
 				Other.vkLayout = nullptr;
@@ -138,10 +181,26 @@ namespace SOV {
 				return vkLayout;
 			}
 
+			Flag getFlags() const {
+				return flags;
+			}
+
+			// Sorted by binding number, whatever the order they were given in.
+			const ACTL::Array<Binding>& getBindings() const {
+				return bindings;
+			}
+
 		private:
+			static constexpr unsigned localBindingCount = 16;
+
 			VkDescriptorSetLayout vkLayout = nullptr;
+
+			Flag flags;
+
+			ACTL::Array<Binding> bindings;
 		};
 
+		// Sets are freed on destruction if Pool has FREE_DESCRIPTOR_SET, otherwise with Pool::Reset.
 		class Set::Array {
 		public:
 			const Descriptor::Pool& Pool;
@@ -187,5 +246,75 @@ namespace SOV {
 		private:
 			VkDescriptorSet* vkSets = nullptr;
 		};
+
+		// Updates a set from one block of descriptor infos with a single call.
+		class Template {
+		public:
+			struct Entry {
+				unsigned binding;
+
+				unsigned arrayElement;
+
+				unsigned descriptorCount;
+
+				Descriptor::Type descriptorType;
+
+				SOV::size offset;
+
+				SOV::size stride;
+			};
+
+			const SOV::Device& Device;
+
+			Template(const Template&) = delete;
+
+			Template& operator =(const Template&) = delete;
+
+			// Covers every binding of SetLayout in binding number order. The data is a packed struct holding one
+			// VkDescriptorImageInfo, VkDescriptorBufferInfo or VkBufferView per descriptor.
+			Template(const Set::Layout& SetLayout);
+
+			Template(const Set::Layout& SetLayout, const ACTL::Array<Entry>& entries);
+
+			// Pushes descriptors of a PUSH_DESCRIPTOR SetLayout bound as set of vkLayout, with the entries of Template(SetLayout).
+			Template(const Set::Layout& SetLayout, Pipeline::BindPoint bindPoint, VkPipelineLayout vkLayout, unsigned set);
+
+			Template(Template&& Other) noexcept : Device(Other.Device), dataSize(Other.dataSize) {
+				vkTemplate = Other.vkTemplate;
+
+				Other.vkTemplate = nullptr;
+			}
+
+			~Template();
+
+			void Update(const Set& Set, const void* data) const {
+				vkUpdateDescriptorSetWithTemplate(Device, Set, vkTemplate, data);
+			}
+
+			// Bytes read from the data.
+			SOV::size getDataSize() const {
+				return dataSize;
+			}
+
+			operator VkDescriptorUpdateTemplate() const {
+				return vkTemplate;
+			}
+
+			operator bool() const {
+				return vkTemplate;
+			}
+
+		private:
+			VkDescriptorUpdateTemplate vkTemplate = nullptr;
+
+			SOV::size dataSize = 0;
+
+			void Init(const Set::Layout& SetLayout, const ACTL::Array<Entry>& entries, const Pipeline::BindPoint* bindPoint, VkPipelineLayout vkLayout, unsigned set);
+
+			static ACTL::Array<Entry> GetEntries(const Set::Layout& SetLayout);
+
+			// Size of the info struct read per descriptor.
+			static SOV::size GetDescriptorSize(Type type);
+		};
 	}
 }
\ No newline at end of file
@@ -11,6 +11,12 @@ namespace SOV {
 
 	class Fence;
 
+	class Semaphore;
+
+	class Swapchain;
+
+	class Surface;
+
 	class Memory {
 	public:
 		static constexpr Memory* External = (Memory*)~0;
@@ -47,7 +53,7 @@ namespace SOV {
 			~Type() {};
 
 		private:
-			Type(const SOV::PhysicalDevice& Device) : PhysicalDevice(PhysicalDevice) {};
+			Type(const SOV::PhysicalDevice& Device) : PhysicalDevice(Device) {};
 		};
 
 		struct Requirements {
@@ -95,6 +101,21 @@ namespace SOV {
 		friend Device;
 
 		struct Family;
+
+		class Batch;
+
+		class Channel;
+
+		class Balancer;
+
+		enum class Role {
+			GRAPHICS,
+			COMPUTE,
+			TRANSFER,
+			PRESENT,
+		};
+
+		static constexpr unsigned roleCount = 4;
 		
 		const Family& family;
 
@@ -122,6 +143,16 @@ namespace SOV {
 
 		~Queue() {};
 
+		// Submits all recorded submissions of Batch with one call and clears it. Requires the synchronization2 feature.
+		void Submit(Batch& Batch) const;
+
+		void Submit(Batch& Batch, const Fence& Fence) const;
+
+		// Returns false if swapchain is out of date or suboptimal and should be recreated.
+		bool Present(const Swapchain& Swapchain, unsigned imageIndex, const Semaphore& WaitSemaphore) const;
+
+		void WaitIdle() const;
+
 		operator VkQueue() const {
 			return vkQueue;
 		}
@@ -150,6 +181,8 @@ namespace SOV {
 
 		unsigned queueCount = 0;
 
+		unsigned timestampValidBits = 0;
+
 		Flag flags = Flag::NONE;
 
 		Family(const Family&) = delete;
@@ -162,12 +195,16 @@ namespace SOV {
 			flags = other.flags;
 
 			queueCount = other.queueCount;
+
+			timestampValidBits = other.timestampValidBits;
 		}
 
 		~Family() {};
 
+		bool SupportsPresent(const Surface& Surface) const;
+
 	private:
-		Family(const SOV::PhysicalDevice& Device) : PhysicalDevice(PhysicalDevice) {};
+		Family(const SOV::PhysicalDevice& Device) : PhysicalDevice(Device) {};
 	};
 
 	class PhysicalDevice {
@@ -189,6 +226,17 @@ namespace SOV {
 
 			Version apiVersion;
 
+			unsigned driverVersion;
+
+			unsigned vendorID;
+
+			unsigned deviceID;
+
+			unsigned char pipelineCacheUUID[VK_UUID_SIZE];
+
+			// Nanoseconds per timestamp query tick.
+			float timestampPeriod;
+
 			ACTL::Array<Memory::Type> memoryTypes;
 
 			ACTL::Array<Queue::Family> queueFamilies;
@@ -210,6 +258,9 @@ namespace SOV {
 
 		const Memory::Type& FindMemoryType(unsigned filter, Memory::PropertyFlag memoryProperties) const;
 
+		// Returns the first family having all required and none of the excluded flags, null if there is none.
+		const Queue::Family* FindQueueFamily(Queue::Family::Flag requiredFlags, Queue::Family::Flag excludedFlags) const;
+
 		operator VkPhysicalDevice() const {
 			return vkPhysicalDevice;
 		}
@@ -224,6 +275,51 @@ namespace SOV {
 	public:
 		using Memory = SOV::Memory;
 
+		// Extension commands which are not exported by the loader. Null if extension is not enabled.
+		struct Functions {
+			PFN_vkCmdDrawMultiEXT vkCmdDrawMultiEXT = nullptr;
+
+			PFN_vkCmdDrawMultiIndexedEXT vkCmdDrawMultiIndexedEXT = nullptr;
+
+			PFN_vkCmdBeginConditionalRenderingEXT vkCmdBeginConditionalRenderingEXT = nullptr;
+
+			PFN_vkCmdEndConditionalRenderingEXT vkCmdEndConditionalRenderingEXT = nullptr;
+
+			PFN_vkGetFenceFdKHR vkGetFenceFdKHR = nullptr;
+
+			PFN_vkGetSemaphoreFdKHR vkGetSemaphoreFdKHR = nullptr;
+
+			PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = nullptr;
+
+			PFN_vkCmdPushDescriptorSetWithTemplateKHR vkCmdPushDescriptorSetWithTemplateKHR = nullptr;
+		};
+
+		// Optional features used by this library. Each is enabled if supported, extension ones also need their extension in
+		// the extensions and core ones a Vulkan version having them. Commands needing a disabled feature must not be used.
+		struct Features {
+			bool multiDrawIndirect = false;
+
+			bool drawIndirectFirstInstance = false;
+
+			bool drawIndirectCount = false;
+
+			bool multiDraw = false;
+
+			bool occlusionQueryPrecise = false;
+
+			bool pipelineStatisticsQuery = false;
+
+			bool conditionalRendering = false;
+
+			bool timelineSemaphore = false;
+
+			bool synchronization2 = false;
+
+			bool dynamicRendering = false;
+
+			bool graphicsPipelineLibrary = false;
+		};
+
 		const SOV::PhysicalDevice& PhysicalDevice;
 
 		Device(const Device&) = delete;
@@ -234,11 +330,22 @@ namespace SOV {
 
 		Device(const SOV::PhysicalDevice& PhysicalDevice, const ACTL::Array<Extension>& extensions, const ACTL::Array<ACTL::Array<float>>& queuePriorities);
 
+		// Creates only the queues needed by the roles. Compute and transfer prefer dedicated families, then a second queue of
+		// a shared family, then share a queue. Surface may be null if presentation is not needed.
+		Device(const SOV::PhysicalDevice& PhysicalDevice, const ACTL::Array<Extension>& extensions, const Surface* Surface);
+
 		Device(Device&& Other) noexcept : 
 			PhysicalDevice(Other.PhysicalDevice),
-			Queues(ACTL::move(Other.Queues)) {
+			Queues(ACTL::move(Other.Queues)),
+			functions(Other.functions),
+			features(Other.features),
+			descriptorIndexingFeatures(Other.descriptorIndexingFeatures),
+			descriptorIndexingProperties(Other.descriptorIndexingProperties) {
 			this->~Device();
 
+			for (unsigned i = 0; i < Queue::roleCount; i++)
+				roleQueues[i] = Other.roleQueues[i];
+
 			vkDevice = Other.vkDevice;
 
 			Other.vkDevice = nullptr;
@@ -258,11 +365,46 @@ namespace SOV {
 			return Queues;
 		}
 
+		const Functions& getFunctions() const {
+			return functions;
+		}
+
+		const Features& getFeatures() const {
+			return features;
+		}
+
+		// Every supported feature is enabled on Vulkan 1.2 or if VK_EXT_descriptor_indexing is in the extensions, otherwise
+		// all are false.
+		const VkPhysicalDeviceDescriptorIndexingFeatures& getDescriptorIndexingFeatures() const {
+			return descriptorIndexingFeatures;
+		}
+
+		// Queried together with the features, all limits are 0 when those are false.
+		const VkPhysicalDeviceDescriptorIndexingProperties& getDescriptorIndexingProperties() const {
+			return descriptorIndexingProperties;
+		}
+
+		// Null if the role is unsupported or the device was not created by roles. Different roles may share a queue.
+		const Queue* GetQueue(Queue::Role role) const {
+			return roleQueues[(unsigned)role];
+		}
+
 	private:
 		ACTL::Array<ACTL::Array<Queue>> Queues;
 
+		const Queue* roleQueues[Queue::roleCount] = {};
+
+		Functions functions;
+
+		Features features;
+
+		VkPhysicalDeviceDescriptorIndexingFeatures descriptorIndexingFeatures = {};
+
+		VkPhysicalDeviceDescriptorIndexingProperties descriptorIndexingProperties = {};
 		VkDevice vkDevice = nullptr;
 
 		void Init(const ACTL::Array<Extension>& extensions);
+
+		const Queue* AddRoleQueue(const Queue::Family* Family, bool share);
 	};
 }
\ No newline at end of file
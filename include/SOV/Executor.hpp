@@ -0,0 +1,117 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+
+#include "Sync.hpp"
+
+namespace SOV {
+	// Resumes coroutines suspended on fences or timeline values. All coroutines are resumed on the thread calling Poll or Run,
+	// so any number of GPU jobs can be in flight without a thread per job. Not thread-safe.
+	class Executor {
+	public:
+		// Return type of executor coroutines. Runs eagerly until its first suspension and frees its frame on completion.
+		struct Task {
+			struct promise_type {
+				Task get_return_object() {
+					return {};
+				}
+
+				std::suspend_never initial_suspend() noexcept {
+					return {};
+				}
+
+				std::suspend_never final_suspend() noexcept {
+					return {};
+				}
+
+				void return_void() {};
+
+				// Tasks must not throw.
+				void unhandled_exception() {
+					std::terminate();
+				}
+			};
+		};
+
+		class Awaiter;
+
+		const SOV::Device& Device;
+
+		Executor(const Executor&) = delete;
+
+		Executor& operator =(const Executor&) = delete;
+
+		Executor(const SOV::Device& Device) : Device(Device) {};
+
+		~Executor() {};
+
+		// Fence must outlive the suspension.
+		Awaiter Wait(const Fence& Fence);
+
+		// Timeline must outlive the suspension. Also serves upload and readback tickets, which complete on a timeline value.
+		Awaiter Wait(const Semaphore& Timeline, ACTL::u64 value);
+
+		// Resumes every coroutine whose completion is detected without blocking. Returns the number of resumed coroutines.
+		unsigned Poll();
+
+		// Blocks until no coroutine is suspended on this executor.
+		void Run();
+
+		bool isIdle() const {
+			return pending.isEmpty();
+		}
+
+	private:
+		struct Entry {
+			VkFence vkFence = nullptr;
+
+			VkSemaphore vkSemaphore = nullptr;
+
+			ACTL::u64 value = 0;
+
+			std::coroutine_handle<> handle;
+		};
+
+		// Wait slice when fences and timelines are pending at once, they cannot be waited on by a single call.
+		static constexpr ACTL::u64 mixedTimeout = 1000000;
+
+		ACTL::Array<Entry> pending;
+
+		ACTL::Array<std::coroutine_handle<>> resumable;
+
+		ACTL::Array<VkFence> vkFences;
+
+		ACTL::Array<VkSemaphore> vkSemaphores;
+
+		ACTL::Array<ACTL::u64> values;
+
+		bool isReady(const Entry& entry) const;
+
+		void Block();
+	};
+
+	class Executor::Awaiter {
+	public:
+		friend Executor;
+
+		bool await_ready() const {
+			return Executor.isReady(entry);
+		}
+
+		void await_suspend(std::coroutine_handle<> handle) {
+			entry.handle = handle;
+
+			Executor.pending.EmplaceBack(entry);
+		}
+
+		void await_resume() const {};
+
+	private:
+		SOV::Executor& Executor;
+
+		Entry entry;
+
+		Awaiter(SOV::Executor& Executor, const Entry& entry) : Executor(Executor), entry(entry) {};
+	};
+}
\ No newline at end of file
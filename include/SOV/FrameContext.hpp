@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace SOV {
+	// Ring of frames in flight. BeginFrame only waits if the frame being reused is still executing on the GPU.
+	class FrameContext {
+	public:
+		struct Frame {
+			// Signaled when the GPU finished the frame, must be passed to the frame's last submit.
+			Fence InFlight;
+
+			Semaphore ImageAvailable;
+
+			Semaphore RenderFinished;
+
+			Command::Buffer Buffer;
+		};
+
+		const SOV::Device& Device;
+
+		const unsigned frameCount;
+
+		FrameContext(const FrameContext&) = delete;
+
+		FrameContext& operator =(const FrameContext&) = delete;
+
+		FrameContext(const SOV::Device& Device, unsigned frameCount);
+
+		~FrameContext() {};
+
+		// Advances to the next frame, waits for its previous use and resets its fence.
+		Frame& BeginFrame();
+
+		// Waits for every frame in flight. Must not be called between BeginFrame and the submit signaling its fence.
+		void WaitIdle() const;
+
+		Frame& getFrame() {
+			return frames[frameIndex];
+		}
+
+		const Frame& getFrame() const {
+			return frames[frameIndex];
+		}
+
+		unsigned getFrameIndex() const {
+			return frameIndex;
+		}
+
+		// Number of BeginFrame calls.
+		ACTL::u64 getFrameNumber() const {
+			return frameNumber;
+		}
+
+	private:
+		Command::Pool Pool;
+
+		Command::Buffer::Array Buffers;
+
+		ACTL::Array<Frame> frames;
+
+		unsigned frameIndex;
+
+		ACTL::u64 frameNumber = 0;
+	};
+
+	// One object per frame in flight, accessed through the current frame of a FrameContext.
+	template <typename Type>
+	class PerFrame {
+	public:
+		const FrameContext& Context;
+
+		PerFrame(const PerFrame&) = delete;
+
+		PerFrame& operator =(const PerFrame&) = delete;
+
+		// Every object is constructed from args.
+		template <typename... Args>
+		PerFrame(const FrameContext& Context, const Args&... args) : Context(Context) {
+			objects.SetCapacity(Context.frameCount);
+
+			for (unsigned i = 0; i < Context.frameCount; i++)
+				objects.EmplaceBack(Type(args...));
+		}
+
+		PerFrame(PerFrame&& Other) noexcept : Context(Other.Context), objects(ACTL::move(Other.objects)) {};
+
+		~PerFrame() {};
+
+		Type& operator *() {
+			return objects[Context.getFrameIndex()];
+		}
+
+		const Type& operator *() const {
+			return objects[Context.getFrameIndex()];
+		}
+
+		Type* operator ->() {
+			return &objects[Context.getFrameIndex()];
+		}
+
+		const Type* operator ->() const {
+			return &objects[Context.getFrameIndex()];
+		}
+
+		Type& operator [](unsigned frameIndex) {
+			return objects[frameIndex];
+		}
+
+		const Type& operator [](unsigned frameIndex) const {
+			return objects[frameIndex];
+		}
+
+		Type* begin() {
+			return objects.begin();
+		}
+
+		Type* end() {
+			return objects.end();
+		}
+
+	private:
+		ACTL::Array<Type> objects;
+	};
+}
\ No newline at end of file
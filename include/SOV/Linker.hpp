@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <unordered_map>
+
+#include "Pipeline.hpp"
+#include "Scheduler.hpp"
+
+namespace SOV {
+	namespace Pipeline {
+		// Builds graphics pipelines from cached parts with VK_EXT_graphics_pipeline_library.
+		// Link returns a fast linked pipeline and schedules an optimized link which replaces it once done.
+		// Parts and pipelines live as long as the linker.
+		class Linker {
+		public:
+			class Handle;
+
+			const SOV::Device& Device;
+
+			Linker(const Linker&) = delete;
+
+			Linker& operator =(const Linker&) = delete;
+
+			// Cache may be null.
+			Linker(const SOV::Device& Device, SOV::Scheduler& Scheduler, const Pipeline::Cache* Cache) : Device(Device), Scheduler(Scheduler), Cache(Cache) {};
+
+			// Waits for optimized links in flight.
+			~Linker();
+
+			// Parts missing from the cache are compiled on the calling thread, without blocking other callers. Layout must
+			// outlive the optimized link. Needs the graphicsPipelineLibrary feature.
+			Handle Link(const Graphics::Info& info, const Layout& Layout);
+
+		private:
+			struct Part {
+				Key key;
+
+				Graphics* Library;
+			};
+
+			struct Entry {
+				Key key;
+
+				std::atomic<VkPipeline> vkPipeline = nullptr;
+
+				std::atomic<bool> optimized = false;
+
+				Graphics* FastPipeline = nullptr;
+
+				Graphics* OptimizedPipeline = nullptr;
+			};
+
+			SOV::Scheduler& Scheduler;
+
+			const Pipeline::Cache* Cache;
+
+			std::mutex mutex;
+
+			std::condition_variable condition;
+
+			std::unordered_multimap<ACTL::u64, Part*> parts;
+
+			std::unordered_multimap<ACTL::u64, Entry*> entries;
+
+			unsigned pendingCount = 0;
+
+			// Call with mutex locked.
+			Entry* Find(const Key& key);
+
+			// Compiles a missing part without holding mutex. Parts are never removed, so the returned library stays valid.
+			const Graphics& GetPart(Graphics::Part part, const Graphics::Info& info, const Layout& Layout);
+
+			// Call with mutex locked.
+			const Graphics* FindPart(const Key& key) const;
+		};
+
+		class Linker::Handle {
+		public:
+			friend Linker;
+
+			Handle() {};
+
+			// True once the optimized pipeline replaced the fast linked one.
+			bool isOptimized() const {
+				return entry && entry->optimized.load(std::memory_order_acquire);
+			}
+
+			VkPipeline Get() const {
+				return entry ? entry->vkPipeline.load(std::memory_order_acquire) : nullptr;
+			}
+
+			operator VkPipeline() const {
+				return Get();
+			}
+
+			operator bool() const {
+				return entry;
+			}
+
+		private:
+			const Entry* entry = nullptr;
+
+			Handle(const Entry* entry) : entry(entry) {};
+		};
+	}
+}
\ No newline at end of file
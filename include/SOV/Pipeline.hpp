@@ -0,0 +1,376 @@
+#pragma once
+
+#include "RenderPass.hpp"
+#include "Descriptor.hpp"
+
+namespace SOV {
+	namespace Pipeline {
+		enum class Topology {
+			POINT_LIST     = VK_PRIMITIVE_TOPOLOGY_POINT_LIST,
+			LINE_LIST      = VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
+			LINE_STRIP     = VK_PRIMITIVE_TOPOLOGY_LINE_STRIP,
+			TRIANGLE_LIST  = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+			TRIANGLE_STRIP = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
+			TRIANGLE_FAN   = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN,
+			PATCH_LIST     = VK_PRIMITIVE_TOPOLOGY_PATCH_LIST,
+		};
+
+		enum class PolygonMode {
+			FILL  = VK_POLYGON_MODE_FILL,
+			LINE  = VK_POLYGON_MODE_LINE,
+			POINT = VK_POLYGON_MODE_POINT,
+		};
+
+		enum class CullMode {
+			NONE           = VK_CULL_MODE_NONE,
+			FRONT          = VK_CULL_MODE_FRONT_BIT,
+			BACK           = VK_CULL_MODE_BACK_BIT,
+			FRONT_AND_BACK = VK_CULL_MODE_FRONT_AND_BACK,
+		};
+
+		enum class FrontFace {
+			COUNTER_CLOCKWISE = VK_FRONT_FACE_COUNTER_CLOCKWISE,
+			CLOCKWISE         = VK_FRONT_FACE_CLOCKWISE,
+		};
+
+		// Applied to every color attachment.
+		enum class BlendMode {
+			NONE,
+			ALPHA,
+			PREMULTIPLIED_ALPHA,
+			ADDITIVE,
+		};
+
+		enum class InputRate {
+			VERTEX   = VK_VERTEX_INPUT_RATE_VERTEX,
+			INSTANCE = VK_VERTEX_INPUT_RATE_INSTANCE,
+		};
+
+		class Key;
+
+		class Layout {
+		public:
+			struct PushConstantRange {
+				Shader::StageFlag shaderStageFlags;
+
+				unsigned offset;
+
+				unsigned size;
+			};
+
+			const SOV::Device& Device;
+
+			Layout(const Layout&) = delete;
+
+			Layout& operator =(const Layout&) = delete;
+
+			Layout(
+				const SOV::Device& Device,
+				const ACTL::Array<Descriptor::Set::Layout&>& SetLayouts,
+				const ACTL::Array<PushConstantRange>& pushConstantRanges
+			);
+
+			Layout(Layout&& Other) noexcept : Device(Other.Device), pushConstantRanges(ACTL::move(Other.pushConstantRanges)) {
+				vkLayout = Other.vkLayout;
+
+				key = Other.key;
+
+				Other.vkLayout = nullptr;
+
+				Other.key = nullptr;
+			}
+
+			~Layout();
+
+			// True if every byte is in a range of each of the stages and every range overlapping the bytes only has stages among
+			// them, as vkCmdPushConstants requires.
+			bool CoversPushConstants(Shader::StageFlag shaderStageFlags, unsigned offset, unsigned size) const;
+
+			const ACTL::Array<PushConstantRange>& getPushConstantRanges() const {
+				return pushConstantRanges;
+			}
+
+			// Describes the set layouts and push constant ranges, so it stays valid after the handles are destroyed and
+			// compatible layouts have equal keys.
+			const Key& getKey() const {
+				return *key;
+			}
+
+			operator VkPipelineLayout() const {
+				return vkLayout;
+			}
+
+			operator bool() const {
+				return vkLayout;
+			}
+
+		private:
+			VkPipelineLayout vkLayout = nullptr;
+
+			ACTL::Array<PushConstantRange> pushConstantRanges;
+
+			Key* key = nullptr;
+		};
+
+		// Cache data is stored behind a header identifying the device and driver, files written for other ones are ignored.
+		class Cache {
+		public:
+			const SOV::Device& Device;
+
+			Cache(const Cache&) = delete;
+
+			Cache& operator =(const Cache&) = delete;
+
+			Cache(const SOV::Device& Device) : Device(Device) {
+				Init(nullptr, 0);
+			}
+
+			// Starts empty if the file is missing, corrupted or was written for another device or driver.
+			Cache(const SOV::Device& Device, const char* path);
+
+			Cache(Cache&& Other) noexcept : Device(Other.Device) {
+				vkCache = Other.vkCache;
+
+				Other.vkCache = nullptr;
+			}
+
+			~Cache();
+
+			// Writes to a temporary file which then replaces path. Returns false if the file cannot be written.
+			bool Save(const char* path) const;
+
+			operator VkPipelineCache() const {
+				return vkCache;
+			}
+
+			operator bool() const {
+				return vkCache;
+			}
+
+		private:
+			struct Header {
+				unsigned magic;
+
+				unsigned vendorID;
+
+				unsigned deviceID;
+
+				unsigned driverVersion;
+
+				unsigned char uuid[VK_UUID_SIZE];
+
+				ACTL::u64 dataSize;
+
+				ACTL::u64 dataHash;
+			};
+
+			static constexpr unsigned magic = 0x43505653;
+
+			VkPipelineCache vkCache = nullptr;
+
+			void Init(const void* data, SOV::size size);
+
+			Header GetHeader() const;
+		};
+
+		class Compute {
+		public:
+			const SOV::Device& Device;
+
+			Compute(const Compute&) = delete;
+
+			Compute& operator =(const Compute&) = delete;
+
+			// Cache may be null.
+			Compute(const Shader::Module& Module, const Layout& Layout, const Cache* Cache) : Compute(Module, {}, Layout, Cache) {};
+
+			// Cache may be null.
+			Compute(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout, const Cache* Cache);
+
+			Compute(Compute&& Other) noexcept : Device(Other.Device) {
+				vkPipeline = Other.vkPipeline;
+
+				Other.vkPipeline = nullptr;
+			}
+
+			~Compute();
+
+			operator VkPipeline() const {
+				return vkPipeline;
+			}
+
+			operator bool() const {
+				return vkPipeline;
+			}
+
+		private:
+			VkPipeline vkPipeline = nullptr;
+		};
+
+		// Uses dynamic rendering, viewport and scissor are dynamic state.
+		class Graphics {
+		public:
+			// Subsets of the state which can be compiled separately as libraries and linked, needs VK_EXT_graphics_pipeline_library.
+			enum Part {
+				VERTEX_INPUT      = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+				PRE_RASTERIZATION = VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+				FRAGMENT_SHADER   = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+				FRAGMENT_OUTPUT   = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+			};
+
+			static constexpr unsigned partCount = 4;
+
+			static constexpr Part parts[partCount] = { VERTEX_INPUT, PRE_RASTERIZATION, FRAGMENT_SHADER, FRAGMENT_OUTPUT };
+
+			struct VertexBinding {
+				unsigned binding;
+
+				unsigned stride;
+
+				InputRate inputRate;
+			};
+
+			struct VertexAttribute {
+				unsigned location;
+
+				unsigned binding;
+
+				Format format;
+
+				unsigned offset;
+			};
+
+			struct Info {
+				ACTL::Array<const Shader::Module&> Modules;
+
+				// Specializations[i] applies to Modules[i], may be shorter than Modules.
+				ACTL::Array<Shader::Specialization> Specializations;
+
+				ACTL::Array<VertexBinding> vertexBindings;
+
+				ACTL::Array<VertexAttribute> vertexAttributes;
+
+				Topology topology = Topology::TRIANGLE_LIST;
+
+				PolygonMode polygonMode = PolygonMode::FILL;
+
+				CullMode cullMode = CullMode::NONE;
+
+				FrontFace frontFace = FrontFace::COUNTER_CLOCKWISE;
+
+				SampleCountFlag sampleCount = COUNT_1_BIT;
+
+				bool depthTest = false;
+
+				bool depthWrite = false;
+
+				CompareOp depthCompareOp = CompareOp::LESS;
+
+				BlendMode blendMode = BlendMode::NONE;
+
+				ACTL::Array<Format> colorFormats;
+
+				Format depthFormat = Format::UNDEFINED;
+
+				Format stencilFormat = Format::UNDEFINED;
+			};
+
+			const SOV::Device& Device;
+
+			Graphics(const Graphics&) = delete;
+
+			Graphics& operator =(const Graphics&) = delete;
+
+			// Renders with dynamic rendering, throws if the dynamicRendering feature is not enabled. Cache may be null.
+			Graphics(const SOV::Device& Device, const Info& info, const Layout& Layout, const Cache* Cache) : Device(Device) {
+				Init(info, Layout, Cache, nullptr);
+			}
+
+			// Creates a library holding one part of info, needs the graphicsPipelineLibrary feature. Cache may be null.
+			Graphics(const SOV::Device& Device, const Info& info, const Layout& Layout, const Cache* Cache, Part part) : Device(Device) {
+				Init(info, Layout, Cache, &part);
+			}
+
+			// Links libraries covering all parts, needs the graphicsPipelineLibrary feature. Fast linking skips link time
+			// optimization. Cache may be null.
+			Graphics(const SOV::Device& Device, const ACTL::Array<const Graphics&>& Libraries, const Layout& Layout, bool optimize, const Cache* Cache);
+
+			Graphics(Graphics&& Other) noexcept : Device(Other.Device) {
+				vkPipeline = Other.vkPipeline;
+
+				Other.vkPipeline = nullptr;
+			}
+
+			~Graphics();
+
+			operator VkPipeline() const {
+				return vkPipeline;
+			}
+
+			operator bool() const {
+				return vkPipeline;
+			}
+
+		private:
+			VkPipeline vkPipeline = nullptr;
+
+			// Creates the whole pipeline if part is null.
+			void Init(const Info& info, const Layout& Layout, const Cache* Cache, const Part* part);
+		};
+
+		// Canonical bytes of a pipeline, pipeline layout or descriptor set layout description, equal descriptions give equal keys.
+		// Modules are identified by the hash of their code, layouts by their content rather than their handles.
+		class Key {
+		public:
+			Key(const Shader::Module& Module, const Layout& Layout) : Key(Module, {}, Layout) {};
+
+			Key(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout);
+
+			Key(const Graphics::Info& info, const Layout& Layout);
+
+			// Only the state belonging to part.
+			Key(Graphics::Part part, const Graphics::Info& info, const Layout& Layout);
+
+			Key(const ACTL::Array<Descriptor::Set::Layout&>& SetLayouts, const ACTL::Array<Layout::PushConstantRange>& pushConstantRanges);
+
+			// Bindings are ordered by binding number, so their order in the array does not matter.
+			Key(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings, Descriptor::Set::Layout::Flag flags);
+
+			Key(const Key& Other) : bytes(Other.bytes), hash(Other.hash) {};
+
+			Key(Key&& Other) noexcept : bytes(ACTL::move(Other.bytes)), hash(Other.hash) {};
+
+			~Key() {};
+
+			bool operator ==(const Key& Other) const;
+
+			ACTL::u64 GetHash() const {
+				return hash;
+			}
+
+		private:
+			static constexpr unsigned localBindingCount = 16;
+
+			ACTL::Array<unsigned char> bytes;
+
+			ACTL::u64 hash = 0;
+
+			void Append(const void* data, SOV::size size);
+
+			template <typename Type>
+			void Append(const Type& value) {
+				Append(&value, sizeof(Type));
+			}
+
+			void Append(const Shader::Module& Module);
+
+			void Append(const Shader::Specialization& Specialization);
+
+			void Append(const Layout& Layout);
+
+			void Append(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings, Descriptor::Set::Layout::Flag flags);
+
+			void Append(Graphics::Part part, const Graphics::Info& info, const Layout& Layout);
+		};
+	}
+}
\ No newline at end of file
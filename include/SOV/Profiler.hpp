@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace SOV {
+	// Measures GPU time of labeled scopes with timestamp queries. Results are read back frameCount frames later without waiting.
+	// Labels are stored by pointer and must outlive the profiler.
+	class Profiler {
+	public:
+		class Scope;
+
+		friend Scope;
+
+		// Times are in milliseconds.
+		struct Statistics {
+			const char* label;
+
+			unsigned count;
+
+			double last;
+
+			double average;
+
+			double min;
+
+			double max;
+		};
+
+		const SOV::Device& Device;
+
+		const unsigned frameCount;
+
+		const unsigned maxScopeCount;
+
+		Profiler(const Profiler&) = delete;
+
+		Profiler& operator =(const Profiler&) = delete;
+
+		// frameCount should be greater than number of frames in flight, otherwise results of late frames are dropped. Throws if
+		// family has no timestamp support.
+		Profiler(const SOV::Device& Device, const Queue::Family& family, unsigned frameCount, unsigned maxScopeCount);
+
+		~Profiler();
+
+		// Reads back the oldest frame and resets its queries for reuse. Must be recorded outside of a render pass.
+		void BeginFrame(const Command::Buffer& Buffer);
+
+		// Adds a time measured elsewhere, such as on the host, to the statistics of label.
+		void Add(const char* label, double time) {
+			Accumulate(label, time);
+		}
+
+		void ResetStatistics() {
+			statistics.Clear();
+		}
+
+		const ACTL::Array<Statistics>& getStatistics() const {
+			return statistics;
+		}
+
+	private:
+		struct Frame {
+			ACTL::Array<const char*> labels;
+
+			bool pending = false;
+		};
+
+		Query::Pool Pool;
+
+		ACTL::Array<Frame> frames;
+
+		ACTL::Array<Statistics> statistics;
+
+		ACTL::u64* results = nullptr;
+
+		ACTL::u64 timestampMask = 0;
+
+		unsigned currentFrame = 0;
+
+		unsigned Allocate(const char* label);
+
+		void Resolve(Frame& frame, unsigned firstQuery);
+
+		void Accumulate(const char* label, double time);
+	};
+
+	class Profiler::Scope {
+	public:
+		Scope(const Scope&) = delete;
+
+		Scope& operator =(const Scope&) = delete;
+
+		Scope(Profiler& Profiler, const Command::Buffer& Buffer, const char* label) : Profiler(Profiler), Buffer(Buffer) {
+			query = Profiler.Allocate(label);
+
+			if (query != ~0u)
+				Buffer.WriteTimestamp(Pipeline::TOP_OF_PIPE, Profiler.Pool, query);
+		}
+
+		~Scope() {
+			if (query != ~0u)
+				Buffer.WriteTimestamp(Pipeline::BOTTOM_OF_PIPE, Profiler.Pool, query + 1);
+		}
+
+	private:
+		SOV::Profiler& Profiler;
+
+		const Command::Buffer Buffer;
+
+		unsigned query = ~0u;
+	};
+}
\ No newline at end of file
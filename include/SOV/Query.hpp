@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Device.hpp"
+
+namespace SOV {
+	namespace Query {
+		enum class Type {
+			OCCLUSION           = VK_QUERY_TYPE_OCCLUSION,
+			PIPELINE_STATISTICS = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+			TIMESTAMP           = VK_QUERY_TYPE_TIMESTAMP,
+		};
+
+		enum PipelineStatisticFlag {
+			NO_STATISTICS                              = 0,
+			INPUT_ASSEMBLY_VERTICES                    = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT,
+			INPUT_ASSEMBLY_PRIMITIVES                  = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT,
+			VERTEX_SHADER_INVOCATIONS                  = VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT,
+			GEOMETRY_SHADER_INVOCATIONS                = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_INVOCATIONS_BIT,
+			GEOMETRY_SHADER_PRIMITIVES                 = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_PRIMITIVES_BIT,
+			CLIPPING_INVOCATIONS                       = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT,
+			CLIPPING_PRIMITIVES                        = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT,
+			FRAGMENT_SHADER_INVOCATIONS                = VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT,
+			TESSELLATION_CONTROL_SHADER_PATCHES        = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT,
+			TESSELLATION_EVALUATION_SHADER_INVOCATIONS = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT,
+			COMPUTE_SHADER_INVOCATIONS                 = VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT,
+		};
+
+		enum ControlFlag {
+			NO_CONTROL = 0,
+			PRECISE    = VK_QUERY_CONTROL_PRECISE_BIT,
+		};
+
+		enum ResultFlag {
+			NONE              = 0,
+			RESULT_64         = VK_QUERY_RESULT_64_BIT,
+			WAIT              = VK_QUERY_RESULT_WAIT_BIT,
+			WITH_AVAILABILITY = VK_QUERY_RESULT_WITH_AVAILABILITY_BIT,
+			PARTIAL           = VK_QUERY_RESULT_PARTIAL_BIT,
+		};
+
+		class Pool {
+		public:
+			struct Info {
+				Type type;
+
+				unsigned count;
+
+				// Only for PIPELINE_STATISTICS, each set flag adds one result value per query in bit order.
+				PipelineStatisticFlag pipelineStatisticFlags;
+			};
+
+			const SOV::Device& Device;
+
+			const Type type;
+
+			const unsigned count;
+
+			Pool(const Pool&) = delete;
+
+			Pool& operator =(const Pool&) = delete;
+
+			// Throws for PIPELINE_STATISTICS if the pipelineStatisticsQuery feature is not enabled.
+			Pool(const SOV::Device& Device, const Info& info);
+
+			Pool(Pool&& Other) noexcept : Device(Other.Device), type(Other.type), count(Other.count) {
+				vkPool = Other.vkPool;
+
+				Other.vkPool = nullptr;
+			}
+
+			~Pool();
+
+			// Returns false if results are not available yet and WAIT is not set.
+			bool GetResults(
+				unsigned firstQuery,
+				unsigned queryCount,
+				SOV::size dataSize,
+				void* data,
+				SOV::size stride,
+				ResultFlag resultFlags
+			) const;
+
+			operator VkQueryPool() const {
+				return vkPool;
+			}
+
+			operator bool() const {
+				return vkPool;
+			}
+
+		private:
+			VkQueryPool vkPool = nullptr;
+		};
+	}
+}
\ No newline at end of file
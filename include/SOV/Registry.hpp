@@ -0,0 +1,171 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "Pipeline.hpp"
+
+namespace SOV {
+	namespace Pipeline {
+		// Shares layouts and pipelines between identical descriptions, objects are destroyed with their last reference.
+		// Layouts are keyed by content rather than handle, so objects stay shared across equal layouts and a destroyed layout
+		// cannot alias a new one. Descriptor sets allocated with a shared set layout are compatible with every pipeline layout
+		// using it.
+		class Registry {
+		public:
+			template <typename Type>
+			class Reference;
+
+			const SOV::Device& Device;
+
+			Registry(const Registry&) = delete;
+
+			Registry& operator =(const Registry&) = delete;
+
+			// Cache may be null.
+			Registry(const SOV::Device& Device, const Pipeline::Cache* Cache) : Device(Device), Cache(Cache) {};
+
+			// References must not outlive the registry.
+			~Registry();
+
+			Reference<Descriptor::Set::Layout> GetSetLayout(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings);
+
+			Reference<Descriptor::Set::Layout> GetSetLayout(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings, Descriptor::Set::Layout::Flag flags);
+
+			Reference<Layout> GetLayout(const ACTL::Array<Descriptor::Set::Layout&>& SetLayouts, const ACTL::Array<Layout::PushConstantRange>& pushConstantRanges);
+
+			// The layout keeps the set layouts alive along with it.
+			Reference<Layout> GetLayout(const ACTL::Array<Reference<Descriptor::Set::Layout>>& SetLayouts, const ACTL::Array<Layout::PushConstantRange>& pushConstantRanges);
+
+			// Layout only needs to outlive the call, the pipeline is shared with any layout of equal content.
+			Reference<Compute> GetCompute(const Shader::Module& Module, const Layout& Layout);
+
+			Reference<Compute> GetCompute(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout);
+
+			Reference<Graphics> GetGraphics(const Graphics::Info& info, const Layout& Layout);
+
+			SOV::size GetCount() const;
+
+		private:
+			struct Entry {
+				Key key;
+
+				unsigned referenceCount = 1;
+
+				Descriptor::Set::Layout* SetLayoutObject = nullptr;
+
+				Layout* LayoutObject = nullptr;
+
+				Compute* ComputeObject = nullptr;
+
+				Graphics* GraphicsObject = nullptr;
+
+				// Released with this entry.
+				ACTL::Array<Entry*> dependencies;
+			};
+
+			const Pipeline::Cache* Cache;
+
+			mutable std::mutex mutex;
+
+			std::unordered_multimap<ACTL::u64, Entry*> entries;
+
+			// Creates the object outside of the lock, so a slow driver compile does not block other lookups and references. If
+			// an equal object was inserted meanwhile, it is shared and the new one destroyed.
+			template <typename Type, typename Create>
+			Reference<Type> Get(Key&& key, Type* Entry::* member, const Create& create);
+
+			// Returns the entry equal to key with a new reference, or null.
+			Entry* Find(const Key& key);
+
+			Entry* Insert(Key&& key);
+
+			void AddReference(Entry* entry);
+
+			void Release(Entry* entry);
+
+			static void Delete(Entry* entry);
+		};
+
+		template <typename Type>
+		class Registry::Reference {
+		public:
+			friend Registry;
+
+			Reference() {};
+
+			Reference(const Reference& Other) : registry(Other.registry), entry(Other.entry), object(Other.object) {
+				if (entry)
+					registry->AddReference(entry);
+			}
+
+			Reference(Reference&& Other) noexcept : registry(Other.registry), entry(Other.entry), object(Other.object) {
+				Other.entry = nullptr;
+
+				Other.object = nullptr;
+			}
+
+			Reference& operator =(const Reference& Other) {
+				if (Other.entry)
+					Other.registry->AddReference(Other.entry);
+
+				if (entry)
+					registry->Release(entry);
+
+				registry = Other.registry;
+
+				entry = Other.entry;
+
+				object = Other.object;
+
+				return *this;
+			}
+
+			Reference& operator =(Reference&& Other) noexcept {
+				if (this == &Other)
+					return *this;
+
+				if (entry)
+					registry->Release(entry);
+
+				registry = Other.registry;
+
+				entry = Other.entry;
+
+				object = Other.object;
+
+				Other.entry = nullptr;
+
+				Other.object = nullptr;
+
+				return *this;
+			}
+
+			~Reference() {
+				if (entry)
+					registry->Release(entry);
+			}
+
+			const Type& operator *() const {
+				return *object;
+			}
+
+			const Type* operator ->() const {
+				return object;
+			}
+
+			operator bool() const {
+				return object;
+			}
+
+		private:
+			Registry* registry = nullptr;
+
+			Entry* entry = nullptr;
+
+			const Type* object = nullptr;
+
+			Reference(Registry* registry, Entry* entry, const Type* object) : registry(registry), entry(entry), object(object) {};
+		};
+	}
+}
\ No newline at end of file
@@ -27,6 +27,7 @@ namespace SOV {
 			HOST                           = VK_PIPELINE_STAGE_HOST_BIT,
 			ALL_GRAPHICS                   = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
 			ALL_COMMANDS                   = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+			CONDITIONAL_RENDERING          = VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT,
 		};
 	}
 }
\ No newline at end of file
@@ -3,4 +3,18 @@
 #include "Swapchain.hpp"
 #include "RenderPass.hpp"
 #include "Buffer.hpp"
-#include "Command.hpp"
\ No newline at end of file
+#include "Command.hpp"
+#include "Culling.hpp"
+#include "Profiler.hpp"
+#include "Submission.hpp"
+#include "Scheduler.hpp"
+#include "Executor.hpp"
+#include "FrameContext.hpp"
+#include "Channel.hpp"
+#include "Balancer.hpp"
+#include "Compiler.hpp"
+#include "Registry.hpp"
+#include "Linker.hpp"
+#include "Allocator.hpp"
+#include "Bindless.hpp"
+#include "Writer.hpp"
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include "Sync.hpp"
+
+namespace SOV {
+	// Runs CPU jobs on worker threads once timeline semaphores reach given values.
+	// A single watcher thread blocks in vkWaitSemaphores on all pending timelines at once, so no thread polls the GPU.
+	class Scheduler {
+	public:
+		// Jobs must not throw.
+		using Job = std::function<void()>;
+
+		const SOV::Device& Device;
+
+		Scheduler(const Scheduler&) = delete;
+
+		Scheduler& operator =(const Scheduler&) = delete;
+
+		Scheduler(const SOV::Device& Device, unsigned workerCount);
+
+		// Finishes ready jobs, jobs still waiting on the GPU are dropped.
+		~Scheduler();
+
+		// Timeline must outlive the job.
+		void Schedule(const Semaphore& Timeline, ACTL::u64 value, Job job);
+
+		void Schedule(Job job);
+
+	private:
+		struct Pending {
+			VkSemaphore vkSemaphore;
+
+			ACTL::u64 value;
+
+			Job job;
+		};
+
+		// Host signaled to interrupt the watcher when pending jobs change.
+		Semaphore Wake;
+
+		ACTL::u64 wakeValue = 0;
+
+		ACTL::Array<Pending> pending;
+
+		ACTL::List<Job> ready;
+
+		std::mutex mutex;
+
+		std::condition_variable condition;
+
+		bool stopping = false;
+
+		std::thread watcher;
+
+		ACTL::Array<std::thread> workers;
+
+		void Watch();
+
+		void Work();
+	};
+}
\ No newline at end of file
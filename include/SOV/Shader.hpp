@@ -31,7 +31,7 @@ namespace SOV {
 
 			Module(const SOV::Device& Device, ACTL::Array<unsigned> code, const Info& info);
 
-			Module(Module&& Other) noexcept : Device(Other.Device), info(ACTL::move(Other.info)) {
+			Module(Module&& Other) noexcept : Device(Other.Device), info(ACTL::move(Other.info)), hash(Other.hash) {
 				vkModule = Other.vkModule;
 
 				Other.vkModule = nullptr;
@@ -51,10 +51,78 @@ namespace SOV {
 				return info;
 			}
 
+			// Hash of the SPIR-V code.
+			ACTL::u64 getHash() const {
+				return hash;
+			}
+
 		private:
 			VkShaderModule vkModule = nullptr;
 
 			Info info;
+
+			ACTL::u64 hash = 0;
+		};
+
+		// Values for the specialization constants of a module, given per constant_id.
+		class Specialization {
+		public:
+			Specialization() {};
+
+			// Maps the given members of a constants struct to constant IDs 0, 1, ... in order:
+			// Specialization::Of<&Constants::localSizeX, &Constants::useShadows>(constants).
+			template <auto... Members, typename Type>
+			static Specialization Of(const Type& constants) {
+				Specialization specialization;
+
+				unsigned constantID = 0;
+
+				(specialization.Set(constantID++, constants.*Members), ...);
+
+				return specialization;
+			}
+
+			// Replaces the value if constantID is already set.
+			template <typename Type>
+			void Set(unsigned constantID, const Type& value) {
+				static_assert(sizeof(Type) <= 8, "Specialization constants are scalars.");
+
+				Set(constantID, &value, sizeof(Type));
+			}
+
+			// SPIR-V booleans are VkBool32.
+			void Set(unsigned constantID, bool value) {
+				Set(constantID, (VkBool32)value);
+			}
+
+			// Points into this object.
+			VkSpecializationInfo GetInfo() const {
+				return {
+					.mapEntryCount = (unsigned)entries.GetLength(),
+					.pMapEntries = entries.begin(),
+					.dataSize = data.GetLength(),
+					.pData = data.begin(),
+				};
+			}
+
+			const ACTL::Array<VkSpecializationMapEntry>& getEntries() const {
+				return entries;
+			}
+
+			const ACTL::Array<unsigned char>& getData() const {
+				return data;
+			}
+
+			bool isEmpty() const {
+				return entries.isEmpty();
+			}
+
+		private:
+			ACTL::Array<VkSpecializationMapEntry> entries;
+
+			ACTL::Array<unsigned char> data;
+
+			void Set(unsigned constantID, const void* value, SOV::size size);
 		};
 	}
 }
\ No newline at end of file
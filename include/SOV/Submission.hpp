@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Swapchain.hpp"
+#include "Command.hpp"
+
+namespace SOV {
+	// Gathers command buffers and semaphores of many producers for a single vkQueueSubmit2.
+	// Arrays keep their capacity between submits, so a warmed up batch does not allocate. Not thread-safe.
+	class Queue::Batch {
+	public:
+		friend Queue;
+
+		Batch(const Batch&) = delete;
+
+		Batch& operator =(const Batch&) = delete;
+
+		Batch() {};
+
+		Batch(unsigned submitCapacity, unsigned commandBufferCapacity, unsigned semaphoreCapacity) {
+			submits.SetCapacity(submitCapacity);
+
+			vkSubmits.SetCapacity(submitCapacity);
+
+			vkCommandBuffers.SetCapacity(commandBufferCapacity);
+
+			vkWaits.SetCapacity(semaphoreCapacity);
+
+			vkSignals.SetCapacity(semaphoreCapacity);
+		}
+
+		Batch(Batch&& Other) noexcept :
+			submits(ACTL::move(Other.submits)),
+			vkSubmits(ACTL::move(Other.vkSubmits)),
+			vkCommandBuffers(ACTL::move(Other.vkCommandBuffers)),
+			vkWaits(ACTL::move(Other.vkWaits)),
+			vkSignals(ACTL::move(Other.vkSignals)) {};
+
+		~Batch() {};
+
+		// Starts a new submission. Called implicitly when waiting or executing after a signal.
+		void Begin() {
+			submits.EmplaceBack(Entry{
+				.firstWait = (unsigned)vkWaits.GetLength(),
+				.firstCommandBuffer = (unsigned)vkCommandBuffers.GetLength(),
+				.firstSignal = (unsigned)vkSignals.GetLength(),
+			});
+		}
+
+		void Wait(const Semaphore& Semaphore, Pipeline::StageFlag stageFlags) {
+			Wait(Semaphore, 0, stageFlags);
+		}
+
+		// Value is ignored for binary semaphores.
+		void Wait(const Semaphore& Semaphore, ACTL::u64 value, Pipeline::StageFlag stageFlags);
+
+		// Adds the wait to every submission recorded so far. Submissions of one call may run concurrently, so a dependency
+		// of the whole batch needs a wait in each of them.
+		void WaitAll(const Semaphore& Semaphore, ACTL::u64 value, Pipeline::StageFlag stageFlags);
+
+		void Execute(const Command::Buffer& Buffer);
+
+		void Signal(const Semaphore& Semaphore, Pipeline::StageFlag stageFlags) {
+			Signal(Semaphore, 0, stageFlags);
+		}
+
+		// Value is ignored for binary semaphores.
+		void Signal(const Semaphore& Semaphore, ACTL::u64 value, Pipeline::StageFlag stageFlags);
+
+		void Clear() {
+			submits.Clear();
+
+			vkCommandBuffers.Clear();
+
+			vkWaits.Clear();
+
+			vkSignals.Clear();
+		}
+
+		bool isEmpty() const {
+			return submits.isEmpty();
+		}
+
+	private:
+		struct Entry {
+			unsigned firstWait = 0, waitCount = 0;
+
+			unsigned firstCommandBuffer = 0, commandBufferCount = 0;
+
+			unsigned firstSignal = 0, signalCount = 0;
+		};
+
+		ACTL::Array<Entry> submits;
+
+		ACTL::Array<VkSubmitInfo2> vkSubmits;
+
+		ACTL::Array<VkCommandBufferSubmitInfo> vkCommandBuffers;
+
+		ACTL::Array<VkSemaphoreSubmitInfo> vkWaits;
+
+		ACTL::Array<VkSemaphoreSubmitInfo> vkSignals;
+
+		Entry& GetOpenSubmit() {
+			if (submits.isEmpty() || submits[submits.GetLength() - 1].signalCount)
+				Begin();
+
+			return submits[submits.GetLength() - 1];
+		}
+
+		const VkSubmitInfo2* Build();
+	};
+}
\ No newline at end of file
@@ -5,11 +5,19 @@
 namespace SOV {
 	class Fence {
 	public:
+		class Pool;
+
 		enum Flag {
 			NONE     = 0,
 			SIGNALED = VK_FENCE_CREATE_SIGNALED_BIT
 		};
 
+		enum HandleType {
+			NO_HANDLE = 0,
+			OPAQUE_FD = VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_FD_BIT,
+			SYNC_FD   = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT,
+		};
+
 		const SOV::Device& Device;
 
 		Fence(const Fence&) = delete;
@@ -17,11 +25,16 @@ namespace SOV {
 		Fence& operator =(const Fence&) = delete;
 
 		Fence(const SOV::Device& Device) : Device(Device) {
-			Init(Flag::NONE);
+			Init(Flag::NONE, NO_HANDLE);
 		}
 
 		Fence(const SOV::Device& Device, Flag flags) : Device(Device) {
-			Init(flags);
+			Init(flags, NO_HANDLE);
+		}
+
+		// Requires VK_KHR_external_fence_fd for FD handle types.
+		Fence(const SOV::Device& Device, Flag flags, HandleType exportTypes) : Device(Device) {
+			Init(flags, exportTypes);
 		}
 
 		Fence(Fence&& Other) noexcept : Device(Other.Device) {
@@ -32,6 +45,23 @@ namespace SOV {
 
 		~Fence();
 
+		// Returns false on timeout, true right away if Fences is empty.
+		static bool Wait(const SOV::Device& Device, const ACTL::Array<const Fence&>& Fences, bool waitAll, ACTL::u64 timeout);
+
+		static void Reset(const SOV::Device& Device, const ACTL::Array<const Fence&>& Fences);
+
+		// Returns false on timeout.
+		bool Wait(ACTL::u64 timeout) const;
+
+		void Reset() const;
+
+		// Returns true if signaled, does not block.
+		bool GetStatus() const;
+
+		// Caller owns the returned descriptor. A SYNC_FD becomes readable once the fence signals,
+		// exporting it resets the fence and yields -1 if the fence has already signaled.
+		int ExportFd(HandleType handleType) const;
+
 		operator VkFence() const {
 			return vkFence;
 		}
@@ -43,20 +73,84 @@ namespace SOV {
 	private:
 		VkFence vkFence = nullptr;
 
-		void Init(Flag flags);
+		void Init(Flag flags, HandleType exportTypes);
+	};
+
+	// Recycles fences instead of creating and destroying them every frame. Not thread-safe.
+	class Fence::Pool {
+	public:
+		const SOV::Device& Device;
+
+		Pool(const Pool&) = delete;
+
+		Pool& operator =(const Pool&) = delete;
+
+		Pool(const SOV::Device& Device) : Device(Device) {};
+
+		Pool(Pool&& Other) noexcept :
+			Device(Other.Device),
+			fences(ACTL::move(Other.fences)),
+			available(ACTL::move(Other.available)),
+			released(ACTL::move(Other.released)),
+			vkResets(ACTL::move(Other.vkResets)) {};
+
+		~Pool() {};
+
+		// Returns an unsignaled fence. It stays owned by the pool.
+		Fence& Acquire();
+
+		// Fence must be signaled or never submitted. It is reset by the next Recycle.
+		void Release(Fence& Fence);
+
+		// Resets all released fences with a single vkResetFences. Called by Acquire when no fence is available.
+		void Recycle();
+
+	private:
+		ACTL::List<Fence> fences;
+
+		ACTL::Array<Fence&> available;
+
+		ACTL::Array<Fence&> released;
+
+		ACTL::Array<VkFence> vkResets;
 	};
 
 	class Semaphore {
 	public:
+		enum class Type {
+			BINARY   = VK_SEMAPHORE_TYPE_BINARY,
+			TIMELINE = VK_SEMAPHORE_TYPE_TIMELINE,
+		};
+
+		enum HandleType {
+			NO_HANDLE = 0,
+			OPAQUE_FD = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT,
+			SYNC_FD   = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT,
+		};
+
 		const SOV::Device& Device;
 
+		const Type type;
+
 		Semaphore(const Semaphore&) = delete;
 
 		Semaphore& operator =(const Semaphore&) = delete;
 
-		Semaphore(const SOV::Device& Device);
+		Semaphore(const SOV::Device& Device) : Device(Device), type(Type::BINARY) {
+			Init(0, NO_HANDLE);
+		}
+
+		// TIMELINE throws if the timelineSemaphore feature is not enabled.
+		Semaphore(const SOV::Device& Device, Type type, ACTL::u64 initialValue) : Device(Device), type(type) {
+			Init(initialValue, NO_HANDLE);
+		}
 
-		Semaphore(Semaphore&& Other) noexcept : Device(Other.Device) {
+		// Requires VK_KHR_external_semaphore_fd for FD handle types. SYNC_FD is only supported by binary semaphores.
+		Semaphore(const SOV::Device& Device, Type type, ACTL::u64 initialValue, HandleType exportTypes) : Device(Device), type(type) {
+			Init(initialValue, exportTypes);
+		}
+
+		Semaphore(Semaphore&& Other) noexcept : Device(Other.Device), type(Other.type) {
 			vkSemaphore = Other.vkSemaphore;
 
 			Other.vkSemaphore = nullptr;
@@ -64,6 +158,19 @@ namespace SOV {
 
 		~Semaphore();
 
+		// Timeline only.
+		ACTL::u64 GetValue() const;
+
+		// Timeline only. Value must be greater than the current one.
+		void Signal(ACTL::u64 value) const;
+
+		// Timeline only. Returns false on timeout.
+		bool Wait(ACTL::u64 value, ACTL::u64 timeout) const;
+
+		// Caller owns the returned descriptor. A SYNC_FD can only be exported after a signal operation was submitted,
+		// it becomes readable once the semaphore signals and the semaphore is unsignaled by the export.
+		int ExportFd(HandleType handleType) const;
+
 		operator VkSemaphore() const {
 			return vkSemaphore;
 		}
@@ -74,5 +181,58 @@ namespace SOV {
 
 	private:
 		VkSemaphore vkSemaphore = nullptr;
+
+		void Init(ACTL::u64 initialValue, HandleType exportTypes);
+	};
+
+	class Event {
+	public:
+		enum Flag {
+			NONE        = 0,
+			DEVICE_ONLY = VK_EVENT_CREATE_DEVICE_ONLY_BIT,
+		};
+
+		const SOV::Device& Device;
+
+		Event(const Event&) = delete;
+
+		Event& operator =(const Event&) = delete;
+
+		Event(const SOV::Device& Device) : Device(Device) {
+			Init(Flag::NONE);
+		}
+
+		// DEVICE_ONLY events cannot be set, reset or queried from the host.
+		Event(const SOV::Device& Device, Flag flags) : Device(Device) {
+			Init(flags);
+		}
+
+		Event(Event&& Other) noexcept : Device(Other.Device) {
+			vkEvent = Other.vkEvent;
+
+			Other.vkEvent = nullptr;
+		}
+
+		~Event();
+
+		void Set() const;
+
+		void Reset() const;
+
+		// Returns true if set.
+		bool GetStatus() const;
+
+		operator VkEvent() const {
+			return vkEvent;
+		}
+
+		operator bool() const {
+			return vkEvent;
+		}
+
+	private:
+		VkEvent vkEvent = nullptr;
+
+		void Init(Flag flags);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace SOV {
+	namespace Descriptor {
+		// Collects descriptor writes and applies them with one vkUpdateDescriptorSets call.
+		// Writes to consecutive elements of a binding are merged into one.
+		class Writer {
+		public:
+			const SOV::Device& Device;
+
+			Writer(const Writer&) = delete;
+
+			Writer& operator =(const Writer&) = delete;
+
+			Writer(const SOV::Device& Device) : Device(Device) {};
+
+			~Writer() {};
+
+			void WriteBuffer(const Set& Set, unsigned binding, unsigned arrayElement, Type type, const Buffer& Buffer, SOV::size offset, SOV::size range);
+
+			void WriteImage(const Set& Set, unsigned binding, unsigned arrayElement, Type type, const Image::View& View, Image::Layout layout);
+
+			// Writes a COMBINED_IMAGE_SAMPLER.
+			void WriteImage(const Set& Set, unsigned binding, unsigned arrayElement, const Image::View& View, Image::Layout layout, const Sampler& Sampler);
+
+			void WriteSampler(const Set& Set, unsigned binding, unsigned arrayElement, const Sampler& Sampler);
+
+			// Storage is kept for the next writes.
+			void Flush();
+
+			// Records the writes as push descriptors of set instead, their sets are ignored. Needs VK_KHR_push_descriptor.
+			void Push(const Command::Buffer& Buffer, Pipeline::BindPoint bindPoint, VkPipelineLayout vkLayout, unsigned set);
+
+			unsigned GetWriteCount() const {
+				return (unsigned)writes.GetLength();
+			}
+
+		private:
+			struct Info {
+				unsigned index;
+
+				bool image;
+			};
+
+			ACTL::Array<VkWriteDescriptorSet> writes;
+
+			ACTL::Array<Info> infos;
+
+			ACTL::Array<VkDescriptorBufferInfo> bufferInfos;
+
+			ACTL::Array<VkDescriptorImageInfo> imageInfos;
+
+			void SetInfoPointers();
+
+			void Clear();
+
+			// The info was just appended.
+			void Add(VkDescriptorSet vkSet, unsigned binding, unsigned arrayElement, Type type, bool image);
+		};
+	}
+}
\ No newline at end of file
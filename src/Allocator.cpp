@@ -0,0 +1,84 @@
+#include "Source.hpp"
+
+namespace SOV {
+	namespace Descriptor {
+		Set Allocator::Allocate(const Set::Layout& SetLayout) {
+			const VkDescriptorSetLayout vkLayout = SetLayout;
+
+			bool added = false;
+
+			while (true) {
+				if (current == Pools.GetLength()) {
+					AddPool();
+
+					added = true;
+				}
+
+				VkDescriptorSetAllocateInfo vkInfo = {
+					.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+					.descriptorPool = Pools[current],
+					.descriptorSetCount = 1,
+					.pSetLayouts = &vkLayout,
+				};
+
+				VkDescriptorSet vkSet = nullptr;
+
+				VkResult result = vkAllocateDescriptorSets(Device, &vkInfo, &vkSet);
+
+				if (!result) {
+					setCount++;
+
+					return vkSet;
+				}
+
+				// A set which does not fit into a new pool will not fit into the next one either.
+				if (added || (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL))
+					throw Exception("Failed to allocate descriptor set.", this, (Exception::Type)result);
+
+				current++;
+			}
+		}
+
+		void Allocator::Reset() {
+			if (Pools.GetLength() > 1 && firstSetCount < info.maxSetCount) {
+				nextSetCount = setCount > firstSetCount * 2 ? setCount : firstSetCount * 2;
+
+				if (nextSetCount > info.maxSetCount)
+					nextSetCount = info.maxSetCount;
+
+				Pools.Clear();
+			}
+			else
+				for (Pool& Pool : Pools)
+					Pool.Reset();
+
+			current = 0;
+
+			setCount = 0;
+		}
+
+		void Allocator::AddPool() {
+			unsigned poolSetCount = nextSetCount;
+
+			if (!Pools.isEmpty())
+				poolSetCount = lastSetCount * 2 < info.maxSetCount ? lastSetCount * 2 : info.maxSetCount;
+
+			Pool::Info poolInfo = {
+				.maxSetCount = poolSetCount,
+				.flags = Pool::NONE,
+			};
+
+			poolInfo.sizes.SetCapacity(info.sizesPerSet.GetLength());
+
+			for (auto& size : info.sizesPerSet)
+				poolInfo.sizes.EmplaceBack(Pool::Size{ size.descriptorType, size.descriptorCount * poolSetCount });
+
+			Pools.EmplaceBack(Pool(Device, poolInfo));
+
+			if (Pools.GetLength() == 1)
+				firstSetCount = poolSetCount;
+
+			lastSetCount = poolSetCount;
+		}
+	}
+}
\ No newline at end of file
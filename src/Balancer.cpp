@@ -0,0 +1,86 @@
+#include "Source.hpp"
+
+namespace SOV {
+	Queue::Balancer::Balancer(const SOV::Device& Device, const Family& family, unsigned streamCount) :
+		Device(Device),
+		family(family),
+		Queues(Device.getQueues()[family.index]) {
+		const unsigned queueCount = (unsigned)Queues.GetLength();
+
+		if (!queueCount)
+			throw Exception("Queue family has no created queues.", this, Exception::Type::OTHER);
+
+		Timelines.SetCapacity(queueCount);
+
+		values.SetCapacity(queueCount);
+
+		for (unsigned i = 0; i < queueCount; i++) {
+			Timelines.EmplaceBack(Semaphore(Device, Semaphore::Type::TIMELINE, 0));
+
+			values.EmplaceBack(0ull);
+		}
+
+		streams.SetCapacity(streamCount);
+
+		for (unsigned i = 0; i < streamCount; i++)
+			streams.EmplaceBack(Ticket{});
+	}
+
+	Queue::Balancer::Ticket Queue::Balancer::Submit(Batch& Batch, unsigned stream) {
+		const unsigned queue = SelectQueue(stream);
+
+		// Separate submissions may finish out of order even on one queue, so a stream waits for its previous ticket.
+		if (stream != noStream && streams[stream].value && !isComplete(streams[stream])) {
+			if (Batch.isEmpty())
+				Batch.Begin();
+
+			Batch.WaitAll(Timelines[streams[stream].queue], streams[stream].value, Pipeline::ALL_COMMANDS);
+		}
+
+		const Ticket ticket = {
+			.queue = queue,
+			.value = values[queue] + 1,
+		};
+
+		Batch.Signal(Timelines[queue], ticket.value, Pipeline::ALL_COMMANDS);
+
+		Queues[queue].Submit(Batch);
+
+		values[queue] = ticket.value;
+
+		if (stream != noStream)
+			streams[stream] = ticket;
+
+		return ticket;
+	}
+
+	Queue::Balancer::Ticket Queue::Balancer::Submit(const Command::Buffer& Buffer, unsigned stream) {
+		BufferBatch.Begin();
+
+		BufferBatch.Execute(Buffer);
+
+		return Submit(BufferBatch, stream);
+	}
+
+	unsigned Queue::Balancer::SelectQueue(unsigned stream) const {
+		// A stream stays on its queue while its last submission executes, the GPU would serialize it behind that one anyway.
+		if (stream != noStream && streams[stream].value && !isComplete(streams[stream]))
+			return streams[stream].queue;
+
+		unsigned best = 0;
+
+		ACTL::u64 bestLoad = GetLoad(0);
+
+		for (unsigned i = 1; i < Queues.GetLength() && bestLoad; i++) {
+			const ACTL::u64 load = GetLoad(i);
+
+			if (load < bestLoad) {
+				best = i;
+
+				bestLoad = load;
+			}
+		}
+
+		return best;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "Source.hpp"
+
+namespace SOV {
+	namespace Descriptor {
+		Bindless::Bindless(const SOV::Device& Device, const Info& info) :
+			Device(Device),
+			info(Clamp(Device, info)),
+			SetLayout(Device, GetBindings(Device, this->info), Set::Layout::UPDATE_AFTER_BIND_POOL),
+			DescriptorPool(Device, GetPoolInfo(this->info)),
+			Sets(DescriptorPool, SetLayout, 1) {
+			slots[SAMPLED_IMAGE].capacity = this->info.sampledImageCount;
+
+			slots[STORAGE_BUFFER].capacity = this->info.storageBufferCount;
+
+			slots[SAMPLER].capacity = this->info.samplerCount;
+		}
+
+		Bindless::Handle Bindless::AddImage(const Image::View& View, Image::Layout layout) {
+			const VkDescriptorImageInfo vkImageInfo = {
+				.imageView = View,
+				.imageLayout = (VkImageLayout)layout,
+			};
+
+			return Write(SAMPLED_IMAGE, &vkImageInfo, nullptr);
+		}
+
+		Bindless::Handle Bindless::AddBuffer(const Buffer& Buffer, SOV::size offset, SOV::size range) {
+			const VkDescriptorBufferInfo vkBufferInfo = {
+				.buffer = Buffer,
+				.offset = offset,
+				.range = range,
+			};
+
+			return Write(STORAGE_BUFFER, nullptr, &vkBufferInfo);
+		}
+
+		Bindless::Handle Bindless::AddSampler(const Sampler& Sampler) {
+			const VkDescriptorImageInfo vkImageInfo = {
+				.sampler = Sampler,
+			};
+
+			return Write(SAMPLER, &vkImageInfo, nullptr);
+		}
+
+		void Bindless::Remove(Kind kind, Handle handle) {
+			std::lock_guard lock(mutex);
+
+			Slots& slot = slots[kind];
+
+			if (handle == invalid || handle >= slot.next)
+				throw Exception("Bindless handle was never added.", this, Exception::Type::OTHER);
+
+			// Scanning the free list is linear, so only debug builds look for double removes.
+			if constexpr (ACTL::debug)
+				for (Handle freeHandle : slot.free)
+					if (freeHandle == handle)
+						throw Exception("Bindless handle was already removed.", this, Exception::Type::OTHER);
+
+			slot.free.EmplaceBack(handle);
+		}
+
+		Bindless::Info Bindless::Clamp(const SOV::Device& Device, const Info& info) {
+			const VkPhysicalDeviceDescriptorIndexingProperties& properties = Device.getDescriptorIndexingProperties();
+
+			const auto clamp = [](unsigned count, unsigned stageLimit, unsigned setLimit) {
+				if (count > stageLimit)
+					count = stageLimit;
+
+				return count < setLimit ? count : setLimit;
+			};
+
+			Info clamped = info;
+
+			clamped.sampledImageCount = clamp(
+				info.sampledImageCount,
+				properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+				properties.maxDescriptorSetUpdateAfterBindSampledImages
+			);
+
+			clamped.storageBufferCount = clamp(
+				info.storageBufferCount,
+				properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers,
+				properties.maxDescriptorSetUpdateAfterBindStorageBuffers
+			);
+
+			clamped.samplerCount = clamp(
+				info.samplerCount,
+				properties.maxPerStageDescriptorUpdateAfterBindSamplers,
+				properties.maxDescriptorSetUpdateAfterBindSamplers
+			);
+
+			const ACTL::u64 total = (ACTL::u64)clamped.sampledImageCount + clamped.storageBufferCount + clamped.samplerCount;
+
+			if (total > properties.maxPerStageUpdateAfterBindResources)
+				throw Exception("Bindless descriptor counts exceed maxPerStageUpdateAfterBindResources.", &Device, Exception::Type::TOO_MANY_OBJECTS);
+
+			return clamped;
+		}
+
+		ACTL::Array<Set::Layout::Binding> Bindless::GetBindings(const SOV::Device& Device, const Info& info) {
+			const VkPhysicalDeviceDescriptorIndexingFeatures& features = Device.getDescriptorIndexingFeatures();
+
+			if (!features.descriptorBindingPartiallyBound ||
+				!features.descriptorBindingSampledImageUpdateAfterBind ||
+				!features.descriptorBindingStorageBufferUpdateAfterBind)
+				throw Exception("Descriptor indexing features for bindless descriptors are not enabled.", &Device, Exception::Type::FEATURE_NOT_PRESENT);
+
+			const auto flags = (Set::Layout::Binding::Flag)(Set::Layout::Binding::UPDATE_AFTER_BIND | Set::Layout::Binding::PARTIALLY_BOUND);
+
+			return {
+				{ SAMPLED_IMAGE, Type::SAMPLED_IMAGE, info.sampledImageCount, info.shaderStageFlags, flags },
+				{ STORAGE_BUFFER, Type::STORAGE_BUFFER, info.storageBufferCount, info.shaderStageFlags, flags },
+				{ SAMPLER, Type::SAMPLER, info.samplerCount, info.shaderStageFlags, flags },
+			};
+		}
+
+		Pool::Info Bindless::GetPoolInfo(const Info& info) {
+			return {
+				.maxSetCount = 1,
+				.sizes = {
+					{ Type::SAMPLED_IMAGE, info.sampledImageCount },
+					{ Type::STORAGE_BUFFER, info.storageBufferCount },
+					{ Type::SAMPLER, info.samplerCount },
+				},
+				.flags = Pool::UPDATE_AFTER_BIND,
+			};
+		}
+
+		Bindless::Handle Bindless::Acquire(Kind kind) {
+			Slots& slot = slots[kind];
+
+			if (!slot.free.isEmpty()) {
+				const Handle handle = slot.free[slot.free.GetLength() - 1];
+
+				slot.free.EraseBack();
+
+				return handle;
+			}
+
+			if (slot.next == slot.capacity)
+				throw Exception("Bindless descriptor array is full.", this, Exception::Type::TOO_MANY_OBJECTS);
+
+			return slot.next++;
+		}
+
+		Bindless::Handle Bindless::Write(Kind kind, const VkDescriptorImageInfo* vkImageInfo, const VkDescriptorBufferInfo* vkBufferInfo) {
+			static constexpr Type types[kindCount] = { Type::SAMPLED_IMAGE, Type::STORAGE_BUFFER, Type::SAMPLER };
+
+			std::lock_guard lock(mutex);
+
+			const Handle handle = Acquire(kind);
+
+			VkWriteDescriptorSet vkWrite = {
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.dstSet = Sets[0],
+				.dstBinding = (unsigned)kind,
+				.dstArrayElement = handle,
+				.descriptorCount = 1,
+				.descriptorType = (VkDescriptorType)types[kind],
+				.pImageInfo = vkImageInfo,
+				.pBufferInfo = vkBufferInfo,
+			};
+
+			vkUpdateDescriptorSets(Device, 1, &vkWrite, 0, nullptr);
+
+			return handle;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "Source.hpp"
+
+namespace SOV {
+	Queue::Channel::~Channel() {
+		Node* node = head.exchange(nullptr);
+
+		while (node) {
+			Node* next = node->next;
+
+			delete node;
+
+			node = next;
+		}
+
+		for (Node* node : pending)
+			delete node;
+	}
+
+	Queue::Channel::Token Queue::Channel::Push(const Submission& submission) {
+		const Token token = lastToken.fetch_add(1) + 1;
+
+		Node* node = new Node{
+			.submission = submission,
+			.token = token,
+			.next = head.load(std::memory_order_relaxed),
+		};
+
+		// Node may be drained and freed as soon as it is linked.
+		while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+
+		return token;
+	}
+
+	unsigned Queue::Channel::Drain() {
+		Node* stack = head.exchange(nullptr, std::memory_order_acquire);
+
+		Node* node = nullptr;
+
+		// Reverses into push order.
+		while (stack) {
+			Node* next = stack->next;
+
+			stack->next = node;
+
+			node = stack;
+
+			stack = next;
+		}
+
+		// Tokens are taken before nodes are linked, so a node may arrive after nodes with later tokens.
+		while (node) {
+			Node* next = node->next;
+
+			SOV::size i = pending.GetLength();
+
+			pending.EmplaceBack(node);
+
+			for (; i && pending[i - 1]->token > node->token; i--)
+				pending[i] = pending[i - 1];
+
+			pending[i] = node;
+
+			node = next;
+		}
+
+		unsigned count = 0;
+
+		while (count < pending.GetLength() && pending[count]->token == lastSubmitted + count + 1) {
+			const Submission& submission = pending[count]->submission;
+
+			Batch.Begin();
+
+			if (submission.Wait)
+				Batch.Wait(*submission.Wait, submission.waitValue, submission.waitStages);
+
+			Batch.Execute(submission.Buffer);
+
+			if (submission.Signal)
+				Batch.Signal(*submission.Signal, submission.signalValue, Pipeline::ALL_COMMANDS);
+
+			Batch.Signal(Timeline, pending[count]->token, Pipeline::ALL_COMMANDS);
+
+			count++;
+		}
+
+		if (!count)
+			return 0;
+
+		Queue.Submit(Batch);
+
+		for (unsigned i = 0; i < count; i++)
+			delete pending[i];
+
+		for (SOV::size i = count; i < pending.GetLength(); i++)
+			pending[i - count] = pending[i];
+
+		for (unsigned i = 0; i < count; i++)
+			pending.EraseBack();
+
+		lastSubmitted += count;
+
+		return count;
+	}
+}
\ No newline at end of file
@@ -42,6 +42,210 @@ namespace SOV {
 				throw Exception("Failed to end command buffer recording.", this, (Exception::Type)result);
 		}
 
+		void Buffer::DrawIndirectCount(
+			const SOV::Device& Device,
+			const SOV::Buffer& Buffer,
+			SOV::size offset,
+			const SOV::Buffer& CountBuffer,
+			SOV::size countOffset,
+			unsigned maxDrawCount,
+			unsigned stride
+		) const {
+			if (!Device.getFeatures().drawIndirectCount)
+				throw Exception("drawIndirectCount feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			vkCmdDrawIndirectCount(
+				vkBuffer,
+				Buffer,
+				offset,
+				CountBuffer,
+				countOffset,
+				maxDrawCount,
+				stride
+			);
+		}
+
+		void Buffer::DrawIndexedIndirectCount(
+			const SOV::Device& Device,
+			const SOV::Buffer& Buffer,
+			SOV::size offset,
+			const SOV::Buffer& CountBuffer,
+			SOV::size countOffset,
+			unsigned maxDrawCount,
+			unsigned stride
+		) const {
+			if (!Device.getFeatures().drawIndirectCount)
+				throw Exception("drawIndirectCount feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			vkCmdDrawIndexedIndirectCount(
+				vkBuffer,
+				Buffer,
+				offset,
+				CountBuffer,
+				countOffset,
+				maxDrawCount,
+				stride
+			);
+		}
+
+		void Buffer::DrawMulti(
+			const SOV::Device& Device,
+			const ACTL::Array<MultiDrawInfo>& draws,
+			unsigned instanceCount,
+			unsigned firstInstance
+		) const {
+			if (!Device.getFeatures().multiDraw)
+				throw Exception("multiDraw feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			auto vkCmdDrawMultiEXT = Device.getFunctions().vkCmdDrawMultiEXT;
+
+			vkCmdDrawMultiEXT(
+				vkBuffer,
+				(unsigned)draws.GetLength(),
+				(const VkMultiDrawInfoEXT*)draws.begin(),
+				instanceCount,
+				firstInstance,
+				sizeof(MultiDrawInfo)
+			);
+		}
+
+		void Buffer::DrawMultiIndexed(
+			const SOV::Device& Device,
+			const ACTL::Array<MultiDrawIndexedInfo>& draws,
+			unsigned instanceCount,
+			unsigned firstInstance
+		) const {
+			if (!Device.getFeatures().multiDraw)
+				throw Exception("multiDraw feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			auto vkCmdDrawMultiIndexedEXT = Device.getFunctions().vkCmdDrawMultiIndexedEXT;
+
+			vkCmdDrawMultiIndexedEXT(
+				vkBuffer,
+				(unsigned)draws.GetLength(),
+				(const VkMultiDrawIndexedInfoEXT*)draws.begin(),
+				instanceCount,
+				firstInstance,
+				sizeof(MultiDrawIndexedInfo),
+				nullptr
+			);
+		}
+
+		void Buffer::BeginConditionalRendering(
+			const SOV::Device& Device,
+			const SOV::Buffer& Buffer,
+			SOV::size offset,
+			bool inverted
+		) const {
+			if (!Device.getFeatures().conditionalRendering)
+				throw Exception("conditionalRendering feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			auto vkCmdBeginConditionalRenderingEXT = Device.getFunctions().vkCmdBeginConditionalRenderingEXT;
+
+			VkConditionalRenderingBeginInfoEXT vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT,
+				.buffer = Buffer,
+				.offset = offset,
+				.flags = inverted ? (VkConditionalRenderingFlagsEXT)VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT : 0,
+			};
+
+			vkCmdBeginConditionalRenderingEXT(vkBuffer, &vkInfo);
+		}
+
+		void Buffer::EndConditionalRendering(const SOV::Device& Device) const {
+			if (!Device.getFeatures().conditionalRendering)
+				throw Exception("conditionalRendering feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			auto vkCmdEndConditionalRenderingEXT = Device.getFunctions().vkCmdEndConditionalRenderingEXT;
+
+			vkCmdEndConditionalRenderingEXT(vkBuffer);
+		}
+
+		void Buffer::PushDescriptorSet(
+			const SOV::Device& Device,
+			Pipeline::BindPoint bindPoint,
+			VkPipelineLayout vkLayout,
+			unsigned set,
+			unsigned writeCount,
+			const VkWriteDescriptorSet* vkWrites
+		) const {
+			auto vkCmdPushDescriptorSetKHR = Device.getFunctions().vkCmdPushDescriptorSetKHR;
+
+			if (!vkCmdPushDescriptorSetKHR)
+				throw Exception("VK_KHR_push_descriptor is not enabled.", this, Exception::Type::EXTENSION_NOT_PRESENT);
+
+			vkCmdPushDescriptorSetKHR(vkBuffer, (VkPipelineBindPoint)bindPoint, vkLayout, set, writeCount, vkWrites);
+		}
+
+		void Buffer::PushDescriptorSet(const Descriptor::Template& Template, VkPipelineLayout vkLayout, unsigned set, const void* data) const {
+			auto vkCmdPushDescriptorSetWithTemplateKHR = Template.Device.getFunctions().vkCmdPushDescriptorSetWithTemplateKHR;
+
+			if (!vkCmdPushDescriptorSetWithTemplateKHR)
+				throw Exception("VK_KHR_push_descriptor is not enabled.", this, Exception::Type::EXTENSION_NOT_PRESENT);
+
+			vkCmdPushDescriptorSetWithTemplateKHR(vkBuffer, Template, vkLayout, set, data);
+		}
+
+		void Buffer::SetEvent(
+			const Event& Event,
+			Pipeline::StageFlag srcStageFlags,
+			AccessFlag srcAccessFlags,
+			Pipeline::StageFlag dstStageFlags,
+			AccessFlag dstAccessFlags
+		) const {
+			RecordEvent(Event, false, srcStageFlags, srcAccessFlags, dstStageFlags, dstAccessFlags);
+		}
+
+		void Buffer::ResetEvent(const Event& Event, Pipeline::StageFlag stageFlags) const {
+			if (!Event.Device.getFeatures().synchronization2)
+				throw Exception("synchronization2 feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			vkCmdResetEvent2(vkBuffer, Event, (VkPipelineStageFlags2)stageFlags);
+		}
+
+		void Buffer::WaitEvent(
+			const Event& Event,
+			Pipeline::StageFlag srcStageFlags,
+			AccessFlag srcAccessFlags,
+			Pipeline::StageFlag dstStageFlags,
+			AccessFlag dstAccessFlags
+		) const {
+			RecordEvent(Event, true, srcStageFlags, srcAccessFlags, dstStageFlags, dstAccessFlags);
+		}
+
+		void Buffer::RecordEvent(
+			const Event& Event,
+			bool wait,
+			Pipeline::StageFlag srcStageFlags,
+			AccessFlag srcAccessFlags,
+			Pipeline::StageFlag dstStageFlags,
+			AccessFlag dstAccessFlags
+		) const {
+			if (!Event.Device.getFeatures().synchronization2)
+				throw Exception("synchronization2 feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			VkMemoryBarrier2 vkBarrier = {
+				.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+				.srcStageMask = (VkPipelineStageFlags2)srcStageFlags,
+				.srcAccessMask = (VkAccessFlags2)srcAccessFlags,
+				.dstStageMask = (VkPipelineStageFlags2)dstStageFlags,
+				.dstAccessMask = (VkAccessFlags2)dstAccessFlags,
+			};
+
+			VkDependencyInfo vkDependency = {
+				.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+				.memoryBarrierCount = 1,
+				.pMemoryBarriers = &vkBarrier,
+			};
+
+			VkEvent vkEvent = Event;
+
+			if (wait)
+				vkCmdWaitEvents2(vkBuffer, 1, &vkEvent, &vkDependency);
+			else
+				vkCmdSetEvent2(vkBuffer, vkEvent, &vkDependency);
+		}
+
 		Buffer::Array::~Array() {
 			if (!vkBuffers)
 				return;
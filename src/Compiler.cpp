@@ -0,0 +1,105 @@
+#include "Source.hpp"
+
+namespace SOV {
+	namespace Pipeline {
+		Compiler::~Compiler() {
+			std::unique_lock lock(mutex);
+
+			condition.wait(lock, [this] { return !pendingCount; });
+
+			for (auto& pair : entries) {
+				delete pair.second->ComputePipeline;
+
+				delete pair.second->GraphicsPipeline;
+
+				delete pair.second;
+			}
+		}
+
+		Compiler::Handle Compiler::Compile(const Shader::Module& Module, const Layout& Layout) {
+			return Compile(Module, {}, Layout);
+		}
+
+		Compiler::Handle Compiler::Compile(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout) {
+			Entry* found = nullptr;
+
+			Entry* entry = Find(Key(Module, Specialization, Layout), found);
+
+			if (!entry)
+				return found;
+
+			Scheduler.Schedule([this, entry, &Module, Specialization, &Layout] {
+				try {
+					entry->ComputePipeline = new Compute(Module, Specialization, Layout, Cache);
+
+					Finish(entry, *entry->ComputePipeline);
+				}
+				catch (...) {
+					Finish(entry, nullptr);
+				}
+			});
+
+			return entry;
+		}
+
+		Compiler::Handle Compiler::Compile(const Graphics::Info& info, const Layout& Layout) {
+			Entry* found = nullptr;
+
+			Entry* entry = Find(Key(info, Layout), found);
+
+			if (!entry)
+				return found;
+
+			Scheduler.Schedule([this, entry, info, &Layout] {
+				try {
+					entry->GraphicsPipeline = new Graphics(Device, info, Layout, Cache);
+
+					Finish(entry, *entry->GraphicsPipeline);
+				}
+				catch (...) {
+					Finish(entry, nullptr);
+				}
+			});
+
+			return entry;
+		}
+
+		Compiler::Entry* Compiler::Find(Key&& key, Entry*& found) {
+			std::lock_guard lock(mutex);
+
+			auto range = entries.equal_range(key.GetHash());
+
+			for (auto i = range.first; i != range.second; i++)
+				if (i->second->key == key) {
+					found = i->second;
+
+					return nullptr;
+				}
+
+			Entry* entry = new Entry{
+				.key = ACTL::move(key),
+			};
+
+			entries.emplace(entry->key.GetHash(), entry);
+
+			pendingCount++;
+
+			return entry;
+		}
+
+		void Compiler::Finish(Entry* entry, VkPipeline vkPipeline) {
+			if (vkPipeline)
+				entry->vkPipeline.store(vkPipeline, std::memory_order_release);
+			else
+				entry->failed.store(true, std::memory_order_release);
+
+			{
+				std::lock_guard lock(mutex);
+
+				pendingCount--;
+			}
+
+			condition.notify_all();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "Source.hpp"
+
+#include <chrono>
+
+namespace SOV {
+	namespace Culling {
+		// Matches the Params uniform block of shaders/Cull.comp (std140).
+		struct Params {
+			Frustum frustum;
+
+			unsigned objectCount;
+
+			unsigned maxDrawCount;
+
+			float hiZWidth;
+
+			float hiZHeight;
+		};
+
+		void Cull(
+			const Frustum& frustum,
+			const ACTL::Array<Object>& objects,
+			ACTL::Array<Buffer::DrawIndexedIndirectInfo>& draws
+		) {
+			draws.Clear();
+
+			for (auto& object : objects) {
+				bool visible = true;
+
+				for (auto& plane : frustum.planes) {
+					const float distance =
+						plane[0] * object.center[0] +
+						plane[1] * object.center[1] +
+						plane[2] * object.center[2] +
+						plane[3];
+
+					if (distance < -object.radius) {
+						visible = false;
+
+						break;
+					}
+				}
+
+				if (!visible)
+					continue;
+
+				draws.EmplaceBack(Buffer::DrawIndexedIndirectInfo{
+					.indexCount = object.indexCount,
+					.instanceCount = 1,
+					.firstIndex = object.firstIndex,
+					.vertexOffset = object.vertexOffset,
+					.firstInstance = object.firstInstance,
+				});
+			}
+		}
+
+		void Benchmark(
+			Profiler& Profiler,
+			const Pass& Pass,
+			const Command::Buffer& Buffer,
+			const Frustum& frustum,
+			const ACTL::Array<Object>& objects
+		) {
+			ACTL::Array<SOV::Buffer::DrawIndexedIndirectInfo> draws(objects.GetLength());
+
+			const auto start = std::chrono::steady_clock::now();
+
+			Cull(frustum, objects, draws);
+
+			const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+
+			Profiler.Add("Culling CPU", time.count());
+
+			Profiler::Scope Scope(Profiler, Buffer, "Culling GPU");
+
+			Pass.Record(Buffer, frustum, (unsigned)objects.GetLength());
+		}
+
+		Pass::Pass(const Shader::Module& Module, const Info& info) :
+			Device(Module.Device),
+			info(Validate(info)),
+			ParamsBuffer(Module.Device, {
+				.size = sizeof(Culling::Params),
+				.usageFlags = (SOV::Buffer::UsageFlag)(SOV::Buffer::UNIFORM_BUFFER | SOV::Buffer::TRANSFER_DST),
+				.sharingMode = SharingMode::EXCLUSIVE,
+			}),
+			ParamsMemory(Module.Device, ParamsBuffer.GetMemoryRequirements(), SOV::Memory::DEVICE_LOCAL),
+			SetLayout(Module.Device, GetBindings(info)),
+			DescriptorPool(Module.Device, GetPoolInfo(info)),
+			Sets(DescriptorPool, SetLayout, 1),
+			Layout(Module.Device, GetSetLayouts(), {}),
+			Compute(Module, Layout, info.Cache) {
+			ParamsBuffer.BindMemory(ParamsMemory, 0);
+
+			WriteDescriptors();
+		}
+
+		void Pass::Record(const Command::Buffer& Buffer, const Frustum& frustum, unsigned objectCount) const {
+			const Culling::Params params = {
+				.frustum = frustum,
+				.objectCount = objectCount,
+				.maxDrawCount = info.maxDrawCount,
+				.hiZWidth = (float)info.hiZExtent.width,
+				.hiZHeight = (float)info.hiZExtent.height,
+			};
+
+			Buffer.PipelineBarrier(
+				Pipeline::DRAW_INDIRECT,
+				AccessFlag::INDIRECT_COMMAND_READ,
+				Pipeline::TRANSFER,
+				AccessFlag::TRANSFER_WRITE
+			);
+
+			Buffer.FillBuffer(*info.DrawCount, 0, sizeof(unsigned), 0);
+
+			Buffer.UpdateBuffer(ParamsBuffer, 0, sizeof(params), &params);
+
+			Buffer.PipelineBarrier(
+				Pipeline::TRANSFER,
+				AccessFlag::TRANSFER_WRITE,
+				Pipeline::COMPUTE_SHADER,
+				(AccessFlag)(AccessFlag::SHADER_READ | AccessFlag::SHADER_WRITE | AccessFlag::UNIFORM_READ)
+			);
+
+			Buffer.BindPipeline(Pipeline::BindPoint::COMPUTE, Compute);
+
+			Buffer.BindDescriptorSets(Pipeline::BindPoint::COMPUTE, Layout, 0, Sets[0]);
+
+			Buffer.Dispatch((objectCount + groupSize - 1) / groupSize, 1, 1);
+
+			Buffer.PipelineBarrier(
+				Pipeline::COMPUTE_SHADER,
+				AccessFlag::SHADER_WRITE,
+				Pipeline::DRAW_INDIRECT,
+				AccessFlag::INDIRECT_COMMAND_READ
+			);
+		}
+
+		const Pass::Info& Pass::Validate(const Info& info) {
+			if (info.HiZ && !info.HiZSampler)
+				throw Exception("Hi-Z culling needs a sampler.", &info, Exception::Type::OTHER);
+
+			return info;
+		}
+
+		ACTL::Array<Descriptor::Set::Layout&> Pass::GetSetLayouts() {
+			ACTL::Array<Descriptor::Set::Layout&> SetLayouts;
+
+			SetLayouts.EmplaceBack(SetLayout);
+
+			return SetLayouts;
+		}
+
+		ACTL::Array<Descriptor::Set::Layout::Binding> Pass::GetBindings(const Info& info) {
+			ACTL::Array<Descriptor::Set::Layout::Binding> bindings = {
+				{ 0, Descriptor::Type::STORAGE_BUFFER, 1, Shader::COMPUTE },
+				{ 1, Descriptor::Type::STORAGE_BUFFER, 1, Shader::COMPUTE },
+				{ 2, Descriptor::Type::STORAGE_BUFFER, 1, Shader::COMPUTE },
+				{ 3, Descriptor::Type::UNIFORM_BUFFER, 1, Shader::COMPUTE },
+			};
+
+			if (info.HiZ)
+				bindings.EmplaceBack(Descriptor::Set::Layout::Binding{ 4, Descriptor::Type::COMBINED_IMAGE_SAMPLER, 1, Shader::COMPUTE });
+
+			return bindings;
+		}
+
+		Descriptor::Pool::Info Pass::GetPoolInfo(const Info& info) {
+			Descriptor::Pool::Info poolInfo = {
+				.maxSetCount = 1,
+				.sizes = {
+					{ Descriptor::Type::STORAGE_BUFFER, 3 },
+					{ Descriptor::Type::UNIFORM_BUFFER, 1 },
+				},
+			};
+
+			if (info.HiZ)
+				poolInfo.sizes.EmplaceBack(Descriptor::Pool::Size{ Descriptor::Type::COMBINED_IMAGE_SAMPLER, 1 });
+
+			return poolInfo;
+		}
+
+		void Pass::WriteDescriptors() {
+			const VkDescriptorBufferInfo vkBufferInfos[4] = {
+				{ .buffer = *info.Objects, .offset = 0, .range = VK_WHOLE_SIZE },
+				{ .buffer = *info.Draws, .offset = 0, .range = VK_WHOLE_SIZE },
+				{ .buffer = *info.DrawCount, .offset = 0, .range = VK_WHOLE_SIZE },
+				{ .buffer = ParamsBuffer, .offset = 0, .range = VK_WHOLE_SIZE },
+			};
+
+			VkDescriptorImageInfo vkImageInfo = {};
+
+			VkWriteDescriptorSet vkWrites[5];
+
+			for (unsigned i = 0; i < 4; i++)
+				vkWrites[i] = {
+					.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+					.dstSet = Sets[0],
+					.dstBinding = i,
+					.descriptorCount = 1,
+					.descriptorType = i == 3 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+					.pBufferInfo = vkBufferInfos + i,
+				};
+
+			unsigned writeCount = 4;
+
+			if (info.HiZ) {
+				vkImageInfo = {
+					.sampler = *info.HiZSampler,
+					.imageView = *info.HiZ,
+					.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+				};
+
+				vkWrites[writeCount++] = {
+					.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+					.dstSet = Sets[0],
+					.dstBinding = 4,
+					.descriptorCount = 1,
+					.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+					.pImageInfo = &vkImageInfo,
+				};
+			}
+
+			vkUpdateDescriptorSets(Device, writeCount, vkWrites, 0, nullptr);
+		}
+	}
+}
\ No newline at end of file
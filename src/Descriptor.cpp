@@ -2,10 +2,10 @@
 
 namespace SOV {
 	namespace Descriptor {
-		Pool::Pool(const SOV::Device& Device, const Info& info) : Device(Device) {
+		Pool::Pool(const SOV::Device& Device, const Info& info) : Device(Device), flags(info.flags) {
 			VkDescriptorPoolCreateInfo vkInfo = {
 				.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-				.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+				.flags = (VkDescriptorPoolCreateFlags)info.flags,
 				.maxSets = info.maxSetCount,
 				.poolSizeCount = (unsigned)info.sizes.GetLength(),
 				.pPoolSizes = (VkDescriptorPoolSize*)info.sizes.begin()
@@ -26,10 +26,41 @@ namespace SOV {
 			vkPool = nullptr;
 		}
 
-		Set::Layout::Layout(const SOV::Device& Device, const ACTL::Array<Binding>& bindings) : Device(Device) {
+		void Pool::Reset() {
+			VkResult result = vkResetDescriptorPool(Device, vkPool, 0);
+
+			if (result)
+				throw Exception("Failed to reset descriptor pool.", this, (Exception::Type)result);
+		}
+
+		Set::Layout::Layout(const SOV::Device& Device, const ACTL::Array<Binding>& bindings, Flag flags) : Device(Device), flags(flags), bindings(bindings) {
 			const unsigned bindingCount = (unsigned)bindings.GetLength();
 
-			VkDescriptorSetLayoutBinding* vkBindings = new VkDescriptorSetLayoutBinding[bindingCount];
+			// Insertion sort, binding lists are short. Layouts shared through a registry then agree on the order of their
+			// bindings with every description of equal key.
+			for (unsigned i = 1; i < bindingCount; i++) {
+				const Binding binding = this->bindings[i];
+
+				unsigned j = i;
+
+				for (; j > 0 && this->bindings[j - 1].binding > binding.binding; j--)
+					this->bindings[j] = this->bindings[j - 1];
+
+				this->bindings[j] = binding;
+			}
+
+			// Most layouts have few bindings, those are converted on the stack.
+			VkDescriptorSetLayoutBinding localBindings[localBindingCount];
+
+			VkDescriptorBindingFlags localBindingFlags[localBindingCount];
+
+			const bool local = bindingCount <= localBindingCount;
+
+			VkDescriptorSetLayoutBinding* vkBindings = local ? localBindings : new VkDescriptorSetLayoutBinding[bindingCount];
+
+			VkDescriptorBindingFlags* vkBindingFlags = local ? localBindingFlags : new VkDescriptorBindingFlags[bindingCount];
+
+			bool hasBindingFlags = false;
 
 			for (unsigned i = 0; i < bindingCount; i++) {
 				auto& binding = bindings[i];
@@ -41,17 +72,34 @@ namespace SOV {
 					.stageFlags = (VkShaderStageFlags)binding.shaderStageFlags,
 					.pImmutableSamplers = nullptr
 				};
+
+				vkBindingFlags[i] = (VkDescriptorBindingFlags)binding.flags;
+
+				if (binding.flags)
+					hasBindingFlags = true;
 			}
 
+			VkDescriptorSetLayoutBindingFlagsCreateInfo vkFlagsInfo = {
+				.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+				.bindingCount = bindingCount,
+				.pBindingFlags = vkBindingFlags,
+			};
+
 			VkDescriptorSetLayoutCreateInfo vkInfo = {
 				.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+				.pNext = hasBindingFlags ? &vkFlagsInfo : nullptr,
+				.flags = (VkDescriptorSetLayoutCreateFlags)flags,
 				.bindingCount = bindingCount,
 				.pBindings = vkBindings,
 			};
 
 			VkResult result = vkCreateDescriptorSetLayout(Device, &vkInfo, nullptr, &vkLayout);
 
-			delete[] vkBindings;
+			if (!local) {
+				delete[] vkBindings;
+
+				delete[] vkBindingFlags;
+			}
 
 			if (result)
 				throw Exception("Failed to create descriptor set layout.", this, (Exception::Type)result);
@@ -120,11 +168,119 @@ namespace SOV {
 			if (!vkSets)
 				return;
 
-			vkFreeDescriptorSets(Pool.Device, Pool, count, vkSets);
+			if (Pool.getFlags() & Pool::FREE_DESCRIPTOR_SET)
+				vkFreeDescriptorSets(Pool.Device, Pool, count, vkSets);
 
 			delete[] vkSets;
 
 			vkSets = nullptr;
 		}
+
+		Template::Template(const Set::Layout& SetLayout) : Device(SetLayout.Device) {
+			Init(SetLayout, GetEntries(SetLayout), nullptr, nullptr, 0);
+		}
+
+		Template::Template(const Set::Layout& SetLayout, const ACTL::Array<Entry>& entries) : Device(SetLayout.Device) {
+			Init(SetLayout, entries, nullptr, nullptr, 0);
+		}
+
+		Template::Template(const Set::Layout& SetLayout, Pipeline::BindPoint bindPoint, VkPipelineLayout vkLayout, unsigned set) : Device(SetLayout.Device) {
+			Init(SetLayout, GetEntries(SetLayout), &bindPoint, vkLayout, set);
+		}
+
+		Template::~Template() {
+			if (!vkTemplate)
+				return;
+
+			vkDestroyDescriptorUpdateTemplate(Device, vkTemplate, nullptr);
+
+			vkTemplate = nullptr;
+		}
+
+		void Template::Init(const Set::Layout& SetLayout, const ACTL::Array<Entry>& entries, const Pipeline::BindPoint* bindPoint, VkPipelineLayout vkLayout, unsigned set) {
+			const unsigned entryCount = (unsigned)entries.GetLength();
+
+			VkDescriptorUpdateTemplateEntry* vkEntries = new VkDescriptorUpdateTemplateEntry[entryCount];
+
+			for (unsigned i = 0; i < entryCount; i++) {
+				if (entries[i].descriptorCount) {
+					const SOV::size end = entries[i].offset + entries[i].stride * (entries[i].descriptorCount - 1) + GetDescriptorSize(entries[i].descriptorType);
+
+					if (end > dataSize)
+						dataSize = end;
+				}
+
+				vkEntries[i] = {
+					.dstBinding = entries[i].binding,
+					.dstArrayElement = entries[i].arrayElement,
+					.descriptorCount = entries[i].descriptorCount,
+					.descriptorType = (VkDescriptorType)entries[i].descriptorType,
+					.offset = entries[i].offset,
+					.stride = entries[i].stride,
+				};
+			}
+
+			VkDescriptorUpdateTemplateCreateInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,
+				.descriptorUpdateEntryCount = entryCount,
+				.pDescriptorUpdateEntries = vkEntries,
+				.templateType = bindPoint ? VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR : VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET,
+				.descriptorSetLayout = SetLayout,
+				.pipelineBindPoint = bindPoint ? (VkPipelineBindPoint)*bindPoint : VK_PIPELINE_BIND_POINT_GRAPHICS,
+				.pipelineLayout = vkLayout,
+				.set = set,
+			};
+
+			VkResult result = vkCreateDescriptorUpdateTemplate(Device, &vkInfo, nullptr, &vkTemplate);
+
+			delete[] vkEntries;
+
+			if (result)
+				throw Exception("Failed to create descriptor update template.", this, (Exception::Type)result);
+		}
+
+		ACTL::Array<Template::Entry> Template::GetEntries(const Set::Layout& SetLayout) {
+			ACTL::Array<Entry> entries;
+
+			entries.SetCapacity(SetLayout.getBindings().GetLength());
+
+			SOV::size offset = 0;
+
+			// The info structs are all 8 byte aligned, so packed members follow each other without padding.
+			for (auto& binding : SetLayout.getBindings()) {
+				const SOV::size stride = GetDescriptorSize(binding.descriptorType);
+
+				entries.EmplaceBack(Entry{
+					.binding = binding.binding,
+					.arrayElement = 0,
+					.descriptorCount = binding.descriptorCount,
+					.descriptorType = binding.descriptorType,
+					.offset = offset,
+					.stride = stride,
+				});
+
+				offset += stride * binding.descriptorCount;
+			}
+
+			return entries;
+		}
+
+		SOV::size Template::GetDescriptorSize(Type type) {
+			switch (type) {
+			case Type::SAMPLER:
+			case Type::COMBINED_IMAGE_SAMPLER:
+			case Type::SAMPLED_IMAGE:
+			case Type::STORAGE_IMAGE:
+			case Type::INPUT_ATTACHMENT:
+				return sizeof(VkDescriptorImageInfo);
+
+			case Type::UNIFORM_TEXEL_BUFFER:
+			case Type::STORAGE_TEXEL_BUFFER:
+				return sizeof(VkBufferView);
+
+			default:
+				return sizeof(VkDescriptorBufferInfo);
+			}
+		}
 	}
 }
\ No newline at end of file
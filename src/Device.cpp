@@ -1,5 +1,7 @@
 #include "Source.hpp"
 
+#include <string.h>
+
 namespace SOV {
 	Memory::Memory(const SOV::Device& Device, const Requirements& requirements, PropertyFlag propertyFlags) : Device(Device) {
 		VkMemoryAllocateInfo vkInfo = {
@@ -54,6 +56,25 @@ namespace SOV {
 		throw Exception("Failed to find suitable memory type.", this, Exception::Type::OTHER);
 	}
 
+	const Queue::Family* PhysicalDevice::FindQueueFamily(Queue::Family::Flag requiredFlags, Queue::Family::Flag excludedFlags) const {
+		for (auto& family : info.queueFamilies)
+			if ((family.flags & requiredFlags) == requiredFlags && !(family.flags & excludedFlags))
+				return &family;
+
+		return nullptr;
+	}
+
+	bool Queue::Family::SupportsPresent(const Surface& Surface) const {
+		VkBool32 supported = VK_FALSE;
+
+		VkResult result = vkGetPhysicalDeviceSurfaceSupportKHR(PhysicalDevice, index, Surface, &supported);
+
+		if (result)
+			throw Exception("Failed to get surface support.", this, (Exception::Type)result);
+
+		return supported;
+	}
+
 	PhysicalDevice::PhysicalDevice(const SOV::Instance& Instance, VkPhysicalDevice vkPhysicalDevice):
 		Instance(Instance),
 		vkPhysicalDevice(vkPhysicalDevice) {
@@ -71,6 +92,16 @@ namespace SOV {
 			.patch = (unsigned short)VK_VERSION_PATCH(properties.apiVersion),
 		};
 
+		info.driverVersion = properties.driverVersion;
+
+		info.vendorID = properties.vendorID;
+
+		info.deviceID = properties.deviceID;
+
+		memcpy(info.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+		info.timestampPeriod = properties.limits.timestampPeriod;
+
 		VkPhysicalDeviceMemoryProperties memoryProperties;
 
 		vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &memoryProperties);
@@ -107,6 +138,8 @@ namespace SOV {
 			family.flags = (Queue::Family::Flag)vkFamily.queueFlags;
 
 			family.queueCount = vkFamily.queueCount;
+
+			family.timestampValidBits = vkFamily.timestampValidBits;
 		}
 
 		delete[] familyProperties;
@@ -158,6 +191,71 @@ namespace SOV {
 		Init(extensions);
 	}
 
+	Device::Device(const SOV::PhysicalDevice& PhysicalDevice, const ACTL::Array<Extension>& extensions, const Surface* Surface) :
+		PhysicalDevice(PhysicalDevice) {
+		using Flag = Queue::Family::Flag;
+
+		const Queue::Family* Graphics = nullptr;
+
+		const Queue::Family* Present = nullptr;
+
+		if (Surface)
+			for (auto& family : PhysicalDevice.info.queueFamilies)
+				if ((family.flags & Flag::GRAPHICS) && family.SupportsPresent(*Surface)) {
+					Graphics = &family;
+
+					Present = &family;
+
+					break;
+				}
+
+		if (!Graphics)
+			Graphics = PhysicalDevice.FindQueueFamily(Flag::GRAPHICS, Flag::NONE);
+
+		if (Surface && !Present)
+			for (auto& family : PhysicalDevice.info.queueFamilies)
+				if (family.SupportsPresent(*Surface)) {
+					Present = &family;
+
+					break;
+				}
+
+		const Queue::Family* Compute = PhysicalDevice.FindQueueFamily(Flag::COMPUTE, Flag::GRAPHICS);
+
+		if (!Compute)
+			Compute = PhysicalDevice.FindQueueFamily(Flag::COMPUTE, Flag::NONE);
+
+		const Queue::Family* Transfer = PhysicalDevice.FindQueueFamily(Flag::TRANSFER, (Flag)(Flag::GRAPHICS | Flag::COMPUTE));
+
+		if (!Transfer)
+			Transfer = PhysicalDevice.FindQueueFamily(Flag::TRANSFER, Flag::GRAPHICS);
+
+		// Graphics and compute families support transfers implicitly.
+		if (!Transfer)
+			Transfer = Compute ? Compute : Graphics;
+
+		const unsigned familyCount = (unsigned)PhysicalDevice.info.queueFamilies.GetLength();
+
+		Queues.SetCapacity(familyCount);
+
+		for (unsigned i = 0; i < familyCount; i++)
+			Queues.EmplaceBack(ACTL::Array<Queue>(PhysicalDevice.info.queueFamilies[i].queueCount));
+
+		roleQueues[(unsigned)Queue::Role::GRAPHICS] = AddRoleQueue(Graphics, false);
+
+		roleQueues[(unsigned)Queue::Role::COMPUTE] = AddRoleQueue(Compute, false);
+
+		roleQueues[(unsigned)Queue::Role::TRANSFER] = AddRoleQueue(Transfer, false);
+
+		// Presenting shares the graphics queue rather than whichever queue compute or transfer added last to the family.
+		if (Present && Present == Graphics)
+			roleQueues[(unsigned)Queue::Role::PRESENT] = roleQueues[(unsigned)Queue::Role::GRAPHICS];
+		else
+			roleQueues[(unsigned)Queue::Role::PRESENT] = AddRoleQueue(Present, true);
+
+		Init(extensions);
+	}
+
 	Device::~Device() {
 		if (!vkDevice)
 			return;
@@ -172,15 +270,20 @@ namespace SOV {
 
 		VkDeviceQueueCreateInfo* queueInfos = new VkDeviceQueueCreateInfo[familyCount];
 
+		unsigned queueInfoCount = 0;
+
 		for (unsigned i = 0; i < familyCount; i++) {
 			const unsigned queueCount = (unsigned)Queues[i].GetLength();
 
+			if (!queueCount)
+				continue;
+
 			float* priorities = new float[queueCount];
 
 			for (unsigned j = 0; j < queueCount; j++)
 				priorities[j] = Queues[i][j].priority;
 
-			queueInfos[i] = {
+			queueInfos[queueInfoCount++] = {
 				.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
 				.queueFamilyIndex = i,
 				.queueCount = queueCount,
@@ -195,12 +298,191 @@ namespace SOV {
 		for (unsigned i = 0; i < extensionCount; i++)
 			vkExtensions[i] = extensions[i];
 
+		bool descriptorIndexing = false;
+
+		bool multiDraw = false;
+
+		bool conditionalRendering = false;
+
+		bool graphicsPipelineLibrary = false;
+
+		for (unsigned i = 0; i < extensionCount; i++)
+			if (!strcmp(vkExtensions[i], VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+				descriptorIndexing = true;
+			else if (!strcmp(vkExtensions[i], VK_EXT_MULTI_DRAW_EXTENSION_NAME))
+				multiDraw = true;
+			else if (!strcmp(vkExtensions[i], VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME))
+				conditionalRendering = true;
+			else if (!strcmp(vkExtensions[i], VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+				graphicsPipelineLibrary = true;
+
+		const Version& instanceVersion = PhysicalDevice.Instance.info.vulkanVersion;
+
+		const Version& deviceVersion = PhysicalDevice.info.apiVersion;
+
+		const unsigned vkInstanceVersion = VK_MAKE_VERSION(instanceVersion.major, instanceVersion.minor, instanceVersion.patch);
+
+		const unsigned vkDeviceVersion = VK_MAKE_VERSION(deviceVersion.major, deviceVersion.minor, deviceVersion.patch);
+
+		// Core features need both the instance and the physical device to use their version.
+		const unsigned apiVersion = vkInstanceVersion < vkDeviceVersion ? vkInstanceVersion : vkDeviceVersion;
+
+		VkPhysicalDeviceFeatures2 vkFeatures = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		};
+
+		VkPhysicalDeviceVulkan12Features vulkan12Features = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+		};
+
+		VkPhysicalDeviceVulkan13Features vulkan13Features = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES,
+		};
+
+		VkPhysicalDeviceMultiDrawFeaturesEXT multiDrawFeatures = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT,
+		};
+
+		VkPhysicalDeviceConditionalRenderingFeaturesEXT conditionalRenderingFeatures = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT,
+		};
+
+		VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT graphicsPipelineLibraryFeatures = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT,
+		};
+
+		descriptorIndexingFeatures = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES,
+		};
+
+		// Extension structures may only be chained if their extension is enabled. Vulkan 1.2 features must not be chained
+		// together with the descriptor indexing structure, which they include.
+		if (apiVersion >= VK_API_VERSION_1_2) {
+			vulkan12Features.pNext = vkFeatures.pNext;
+
+			vkFeatures.pNext = &vulkan12Features;
+		}
+		else if (descriptorIndexing) {
+			descriptorIndexingFeatures.pNext = vkFeatures.pNext;
+
+			vkFeatures.pNext = &descriptorIndexingFeatures;
+		}
+
+		if (apiVersion >= VK_API_VERSION_1_3) {
+			vulkan13Features.pNext = vkFeatures.pNext;
+
+			vkFeatures.pNext = &vulkan13Features;
+		}
+
+		if (multiDraw) {
+			multiDrawFeatures.pNext = vkFeatures.pNext;
+
+			vkFeatures.pNext = &multiDrawFeatures;
+		}
+
+		if (conditionalRendering) {
+			conditionalRenderingFeatures.pNext = vkFeatures.pNext;
+
+			vkFeatures.pNext = &conditionalRenderingFeatures;
+		}
+
+		if (graphicsPipelineLibrary) {
+			graphicsPipelineLibraryFeatures.pNext = vkFeatures.pNext;
+
+			vkFeatures.pNext = &graphicsPipelineLibraryFeatures;
+		}
+
+		// Vulkan 1.0 can only query core features, extension features then stay disabled.
+		const bool features2 = apiVersion >= VK_API_VERSION_1_1;
+
+		if (features2)
+			vkGetPhysicalDeviceFeatures2(PhysicalDevice, &vkFeatures);
+		else {
+			vkFeatures.pNext = nullptr;
+
+			vkGetPhysicalDeviceFeatures(PhysicalDevice, &vkFeatures.features);
+		}
+
+		// The chain now holds the supported features. Only the ones used by this library are kept, since some features cost
+		// performance just by being enabled. Extension structures are kept as a whole.
+		vkFeatures.features = {
+			.multiDrawIndirect = vkFeatures.features.multiDrawIndirect,
+			.drawIndirectFirstInstance = vkFeatures.features.drawIndirectFirstInstance,
+			.occlusionQueryPrecise = vkFeatures.features.occlusionQueryPrecise,
+			.pipelineStatisticsQuery = vkFeatures.features.pipelineStatisticsQuery,
+		};
+
+		if (apiVersion >= VK_API_VERSION_1_2) {
+			// The descriptor indexing members have the same order in both structures.
+			const SOV::size indexingSize =
+				offsetof(VkPhysicalDeviceDescriptorIndexingFeatures, runtimeDescriptorArray) + sizeof(VkBool32) -
+				offsetof(VkPhysicalDeviceDescriptorIndexingFeatures, shaderInputAttachmentArrayDynamicIndexing);
+
+			memcpy(
+				&descriptorIndexingFeatures.shaderInputAttachmentArrayDynamicIndexing,
+				&vulkan12Features.shaderInputAttachmentArrayDynamicIndexing,
+				indexingSize
+			);
+
+			vulkan12Features = {
+				.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+				.pNext = vulkan12Features.pNext,
+				.drawIndirectCount = vulkan12Features.drawIndirectCount,
+				.descriptorIndexing = vulkan12Features.descriptorIndexing,
+				.timelineSemaphore = vulkan12Features.timelineSemaphore,
+			};
+
+			memcpy(
+				&vulkan12Features.shaderInputAttachmentArrayDynamicIndexing,
+				&descriptorIndexingFeatures.shaderInputAttachmentArrayDynamicIndexing,
+				indexingSize
+			);
+		}
+
+		vulkan13Features = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES,
+			.pNext = vulkan13Features.pNext,
+			.synchronization2 = vulkan13Features.synchronization2,
+			.dynamicRendering = vulkan13Features.dynamicRendering,
+		};
+
+		descriptorIndexingProperties = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES,
+		};
+
+		if (features2 && (apiVersion >= VK_API_VERSION_1_2 || descriptorIndexing)) {
+			VkPhysicalDeviceProperties2 vkProperties = {
+				.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+				.pNext = &descriptorIndexingProperties,
+			};
+
+			vkGetPhysicalDeviceProperties2(PhysicalDevice, &vkProperties);
+
+			descriptorIndexingProperties.pNext = nullptr;
+		}
+
+		features = {
+			.multiDrawIndirect = (bool)vkFeatures.features.multiDrawIndirect,
+			.drawIndirectFirstInstance = (bool)vkFeatures.features.drawIndirectFirstInstance,
+			.drawIndirectCount = (bool)vulkan12Features.drawIndirectCount,
+			.multiDraw = (bool)multiDrawFeatures.multiDraw,
+			.occlusionQueryPrecise = (bool)vkFeatures.features.occlusionQueryPrecise,
+			.pipelineStatisticsQuery = (bool)vkFeatures.features.pipelineStatisticsQuery,
+			.conditionalRendering = (bool)conditionalRenderingFeatures.conditionalRendering,
+			.timelineSemaphore = (bool)vulkan12Features.timelineSemaphore,
+			.synchronization2 = (bool)vulkan13Features.synchronization2,
+			.dynamicRendering = (bool)vulkan13Features.dynamicRendering,
+			.graphicsPipelineLibrary = (bool)graphicsPipelineLibraryFeatures.graphicsPipelineLibrary,
+		};
+
 		VkDeviceCreateInfo vkInfo = {
 			.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-			.queueCreateInfoCount = familyCount,
+			.pNext = features2 ? &vkFeatures : nullptr,
+			.queueCreateInfoCount = queueInfoCount,
 			.pQueueCreateInfos = queueInfos,
 			.enabledExtensionCount = extensionCount,
 			.ppEnabledExtensionNames = vkExtensions,
+			.pEnabledFeatures = features2 ? nullptr : &vkFeatures.features,
 		};
 
 		VkResult result = vkCreateDevice(PhysicalDevice, &vkInfo, nullptr, &vkDevice);
@@ -210,9 +492,42 @@ namespace SOV {
 
 		delete[] vkExtensions;
 
-		for (unsigned i = 0; i < familyCount; i++)
+		for (unsigned i = 0; i < queueInfoCount; i++)
 			delete[] queueInfos[i].pQueuePriorities;
 
 		delete[] queueInfos;
+
+		for (auto& family : Queues)
+			for (auto& Queue : family)
+				vkGetDeviceQueue(vkDevice, Queue.family.index, Queue.index, &Queue.vkQueue);
+
+		functions = {
+			.vkCmdDrawMultiEXT = (PFN_vkCmdDrawMultiEXT)vkGetDeviceProcAddr(vkDevice, "vkCmdDrawMultiEXT"),
+			.vkCmdDrawMultiIndexedEXT = (PFN_vkCmdDrawMultiIndexedEXT)vkGetDeviceProcAddr(vkDevice, "vkCmdDrawMultiIndexedEXT"),
+			.vkCmdBeginConditionalRenderingEXT = (PFN_vkCmdBeginConditionalRenderingEXT)vkGetDeviceProcAddr(vkDevice, "vkCmdBeginConditionalRenderingEXT"),
+			.vkCmdEndConditionalRenderingEXT = (PFN_vkCmdEndConditionalRenderingEXT)vkGetDeviceProcAddr(vkDevice, "vkCmdEndConditionalRenderingEXT"),
+			.vkGetFenceFdKHR = (PFN_vkGetFenceFdKHR)vkGetDeviceProcAddr(vkDevice, "vkGetFenceFdKHR"),
+			.vkGetSemaphoreFdKHR = (PFN_vkGetSemaphoreFdKHR)vkGetDeviceProcAddr(vkDevice, "vkGetSemaphoreFdKHR"),
+			.vkCmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR)vkGetDeviceProcAddr(vkDevice, "vkCmdPushDescriptorSetKHR"),
+			.vkCmdPushDescriptorSetWithTemplateKHR = (PFN_vkCmdPushDescriptorSetWithTemplateKHR)vkGetDeviceProcAddr(vkDevice, "vkCmdPushDescriptorSetWithTemplateKHR"),
+		};
+	}
+
+	const Queue* Device::AddRoleQueue(const Queue::Family* Family, bool share) {
+		if (!Family)
+			return nullptr;
+
+		auto& family = Queues[Family->index];
+
+		if (!family.isEmpty() && (share || family.GetLength() == Family->queueCount))
+			return &family[family.GetLength() - 1];
+
+		SOV::Queue& Queue = family.EmplaceBack(SOV::Queue(*Family));
+
+		Queue.index = (unsigned)family.GetLength() - 1;
+
+		Queue.priority = 1.0f;
+
+		return &Queue;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "Source.hpp"
+
+namespace SOV {
+	Executor::Awaiter Executor::Wait(const Fence& Fence) {
+		return Awaiter(*this, Entry{
+			.vkFence = Fence,
+		});
+	}
+
+	Executor::Awaiter Executor::Wait(const Semaphore& Timeline, ACTL::u64 value) {
+		return Awaiter(*this, Entry{
+			.vkSemaphore = Timeline,
+			.value = value,
+		});
+	}
+
+	unsigned Executor::Poll() {
+		resumable.Clear();
+
+		for (SOV::size i = 0; i < pending.GetLength();) {
+			if (!isReady(pending[i])) {
+				i++;
+
+				continue;
+			}
+
+			resumable.EmplaceBack(pending[i].handle);
+
+			if (i != pending.GetLength() - 1)
+				pending[i] = pending[pending.GetLength() - 1];
+
+			pending.EraseBack();
+		}
+
+		// Resumed coroutines may suspend again and append to pending.
+		for (auto handle : resumable)
+			handle.resume();
+
+		return (unsigned)resumable.GetLength();
+	}
+
+	void Executor::Run() {
+		while (!pending.isEmpty())
+			if (!Poll())
+				Block();
+	}
+
+	bool Executor::isReady(const Entry& entry) const {
+		if (entry.vkFence) {
+			VkResult result = vkGetFenceStatus(Device, entry.vkFence);
+
+			if (result == VK_NOT_READY)
+				return false;
+
+			if (result)
+				throw Exception("Failed to get fence status.", this, (Exception::Type)result);
+
+			return true;
+		}
+
+		ACTL::u64 value = 0;
+
+		VkResult result = vkGetSemaphoreCounterValue(Device, entry.vkSemaphore, (uint64_t*)&value);
+
+		if (result)
+			throw Exception("Failed to get semaphore value.", this, (Exception::Type)result);
+
+		return value >= entry.value;
+	}
+
+	void Executor::Block() {
+		vkFences.Clear();
+
+		vkSemaphores.Clear();
+
+		values.Clear();
+
+		for (auto& entry : pending) {
+			if (entry.vkFence) {
+				vkFences.EmplaceBack(entry.vkFence);
+
+				continue;
+			}
+
+			vkSemaphores.EmplaceBack(entry.vkSemaphore);
+
+			values.EmplaceBack(entry.value);
+		}
+
+		VkResult result;
+
+		if (vkFences.isEmpty()) {
+			VkSemaphoreWaitInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+				.flags = VK_SEMAPHORE_WAIT_ANY_BIT,
+				.semaphoreCount = (unsigned)vkSemaphores.GetLength(),
+				.pSemaphores = vkSemaphores.begin(),
+				.pValues = (const uint64_t*)values.begin(),
+			};
+
+			result = vkWaitSemaphores(Device, &vkInfo, ~0ull);
+		}
+		else
+			result = vkWaitForFences(
+				Device,
+				(unsigned)vkFences.GetLength(),
+				vkFences.begin(),
+				VK_FALSE,
+				vkSemaphores.isEmpty() ? ~0ull : mixedTimeout
+			);
+
+		if (result && result != VK_TIMEOUT)
+			throw Exception("Failed to wait for GPU completion.", this, (Exception::Type)result);
+	}
+}
\ No newline at end of file
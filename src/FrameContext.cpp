@@ -0,0 +1,40 @@
+#include "Source.hpp"
+
+namespace SOV {
+	FrameContext::FrameContext(const SOV::Device& Device, unsigned frameCount) :
+		Device(Device),
+		frameCount(frameCount),
+		Pool(Device),
+		Buffers(Pool, frameCount),
+		frameIndex(frameCount - 1) {
+		frames.SetCapacity(frameCount);
+
+		for (unsigned i = 0; i < frameCount; i++)
+			frames.EmplaceBack(Frame{
+				.InFlight = Fence(Device, Fence::SIGNALED),
+				.ImageAvailable = Semaphore(Device),
+				.RenderFinished = Semaphore(Device),
+				.Buffer = Buffers[i],
+			});
+	}
+
+	FrameContext::Frame& FrameContext::BeginFrame() {
+		frameIndex = (frameIndex + 1) % frameCount;
+
+		frameNumber++;
+
+		Frame& frame = frames[frameIndex];
+
+		if (!frame.InFlight.GetStatus())
+			frame.InFlight.Wait(~0ull);
+
+		frame.InFlight.Reset();
+
+		return frame;
+	}
+
+	void FrameContext::WaitIdle() const {
+		for (auto& frame : frames)
+			frame.InFlight.Wait(~0ull);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "Source.hpp"
+
+namespace SOV {
+	namespace Pipeline {
+		Linker::~Linker() {
+			std::unique_lock lock(mutex);
+
+			condition.wait(lock, [this] { return !pendingCount; });
+
+			for (auto& pair : entries) {
+				delete pair.second->FastPipeline;
+
+				delete pair.second->OptimizedPipeline;
+
+				delete pair.second;
+			}
+
+			for (auto& pair : parts) {
+				delete pair.second->Library;
+
+				delete pair.second;
+			}
+		}
+
+		Linker::Handle Linker::Link(const Graphics::Info& info, const Layout& Layout) {
+			Key key(info, Layout);
+
+			{
+				std::lock_guard lock(mutex);
+
+				if (Entry* entry = Find(key))
+					return entry;
+			}
+
+			// Compiling and linking happen outside of the lock, so other callers and finishing optimized links are not blocked.
+			ACTL::Array<const Graphics&> Libraries;
+
+			Libraries.SetCapacity(Graphics::partCount);
+
+			for (Graphics::Part part : Graphics::parts)
+				Libraries.EmplaceBack(GetPart(part, info, Layout));
+
+			Graphics* FastPipeline = new Graphics(Device, Libraries, Layout, false, Cache);
+
+			Entry* entry = nullptr;
+
+			{
+				std::lock_guard lock(mutex);
+
+				entry = Find(key);
+
+				if (!entry) {
+					entry = new Entry{
+						.key = ACTL::move(key),
+						.vkPipeline = (VkPipeline)*FastPipeline,
+						.FastPipeline = FastPipeline,
+					};
+
+					entries.emplace(entry->key.GetHash(), entry);
+
+					pendingCount++;
+
+					FastPipeline = nullptr;
+				}
+			}
+
+			// Another thread linked an equal pipeline meanwhile.
+			if (FastPipeline) {
+				delete FastPipeline;
+
+				return entry;
+			}
+
+			// Keeps the fast pipeline if the optimized link fails.
+			Scheduler.Schedule([this, entry, Libraries, &Layout] {
+				try {
+					entry->OptimizedPipeline = new Graphics(Device, Libraries, Layout, true, Cache);
+
+					entry->vkPipeline.store(*entry->OptimizedPipeline, std::memory_order_release);
+
+					entry->optimized.store(true, std::memory_order_release);
+				}
+				catch (...) {}
+
+				{
+					std::lock_guard lock(mutex);
+
+					pendingCount--;
+				}
+
+				condition.notify_all();
+			});
+
+			return entry;
+		}
+
+		Linker::Entry* Linker::Find(const Key& key) {
+			auto range = entries.equal_range(key.GetHash());
+
+			for (auto i = range.first; i != range.second; i++)
+				if (i->second->key == key)
+					return i->second;
+
+			return nullptr;
+		}
+
+		const Graphics& Linker::GetPart(Graphics::Part part, const Graphics::Info& info, const Layout& Layout) {
+			Key key(part, info, Layout);
+
+			{
+				std::lock_guard lock(mutex);
+
+				if (const Graphics* Library = FindPart(key))
+					return *Library;
+			}
+
+			Graphics* Library = new Graphics(Device, info, Layout, Cache, part);
+
+			const Graphics* Existing = nullptr;
+
+			{
+				std::lock_guard lock(mutex);
+
+				Existing = FindPart(key);
+
+				if (!Existing) {
+					Part* entry = new Part{
+						.key = ACTL::move(key),
+						.Library = Library,
+					};
+
+					parts.emplace(entry->key.GetHash(), entry);
+
+					return *Library;
+				}
+			}
+
+			// Another thread compiled an equal part meanwhile.
+			delete Library;
+
+			return *Existing;
+		}
+
+		const Graphics* Linker::FindPart(const Key& key) const {
+			auto range = parts.equal_range(key.GetHash());
+
+			for (auto i = range.first; i != range.second; i++)
+				if (i->second->key == key)
+					return i->second->Library;
+
+			return nullptr;
+		}
+	}
+}
\ No newline at end of file
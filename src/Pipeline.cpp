@@ -0,0 +1,764 @@
+#include "Source.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+
+namespace SOV {
+	namespace Pipeline {
+		Layout::Layout(
+			const SOV::Device& Device,
+			const ACTL::Array<Descriptor::Set::Layout&>& SetLayouts,
+			const ACTL::Array<PushConstantRange>& pushConstantRanges
+		) : Device(Device), pushConstantRanges(pushConstantRanges) {
+			const unsigned setLayoutCount = (unsigned)SetLayouts.GetLength();
+
+			const unsigned rangeCount = (unsigned)pushConstantRanges.GetLength();
+
+			VkDescriptorSetLayout* vkSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
+
+			for (unsigned i = 0; i < setLayoutCount; i++)
+				vkSetLayouts[i] = SetLayouts[i];
+
+			VkPushConstantRange* vkRanges = new VkPushConstantRange[rangeCount];
+
+			for (unsigned i = 0; i < rangeCount; i++)
+				vkRanges[i] = {
+					.stageFlags = (VkShaderStageFlags)pushConstantRanges[i].shaderStageFlags,
+					.offset = pushConstantRanges[i].offset,
+					.size = pushConstantRanges[i].size,
+				};
+
+			VkPipelineLayoutCreateInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+				.setLayoutCount = setLayoutCount,
+				.pSetLayouts = vkSetLayouts,
+				.pushConstantRangeCount = rangeCount,
+				.pPushConstantRanges = vkRanges,
+			};
+
+			VkResult result = vkCreatePipelineLayout(Device, &vkInfo, nullptr, &vkLayout);
+
+			delete[] vkSetLayouts;
+
+			delete[] vkRanges;
+
+			if (result)
+				throw Exception("Failed to create pipeline layout.", this, (Exception::Type)result);
+
+			key = new Key(SetLayouts, pushConstantRanges);
+		}
+
+		Layout::~Layout() {
+			delete key;
+
+			key = nullptr;
+
+			if (!vkLayout)
+				return;
+
+			vkDestroyPipelineLayout(Device, vkLayout, nullptr);
+
+			vkLayout = nullptr;
+		}
+
+		bool Layout::CoversPushConstants(Shader::StageFlag shaderStageFlags, unsigned offset, unsigned size) const {
+			const unsigned end = offset + size;
+
+			if (!shaderStageFlags || !size)
+				return false;
+
+			// Every range overlapping the bytes must have all of its stages pushed.
+			for (auto& range : pushConstantRanges)
+				if (range.offset < end && offset < range.offset + range.size && (range.shaderStageFlags & ~shaderStageFlags))
+					return false;
+
+			// Every byte must be in some range of every stage, ranges of a stage may be split or overlap.
+			for (unsigned stage = 1; stage && stage <= (unsigned)shaderStageFlags; stage <<= 1) {
+				if (!(shaderStageFlags & stage))
+					continue;
+
+				unsigned covered = offset;
+
+				while (covered < end) {
+					unsigned next = covered;
+
+					for (auto& range : pushConstantRanges)
+						if ((range.shaderStageFlags & stage) && range.offset <= covered && covered < range.offset + range.size && range.offset + range.size > next)
+							next = range.offset + range.size;
+
+					if (next == covered)
+						return false;
+
+					covered = next;
+				}
+			}
+
+			return true;
+		}
+
+		Cache::Cache(const SOV::Device& Device, const char* path) : Device(Device) {
+			FILE* file = fopen(path, "rb");
+
+			if (!file) {
+				Init(nullptr, 0);
+
+				return;
+			}
+
+			const Header expected = GetHeader();
+
+			Header header;
+
+			unsigned char* data = nullptr;
+
+			long fileSize = -1;
+
+			if (!fseek(file, 0, SEEK_END)) {
+				fileSize = ftell(file);
+
+				rewind(file);
+			}
+
+			// dataSize is only trusted once it matches the file, so a truncated file cannot request a huge allocation.
+			bool valid = fileSize >= (long)sizeof(Header)
+				&& fread(&header, sizeof(Header), 1, file) == 1
+				&& header.dataSize == (ACTL::u64)fileSize - sizeof(Header)
+				&& header.magic == expected.magic
+				&& header.vendorID == expected.vendorID
+				&& header.deviceID == expected.deviceID
+				&& header.driverVersion == expected.driverVersion
+				&& !memcmp(header.uuid, expected.uuid, VK_UUID_SIZE);
+
+			if (valid) {
+				data = new unsigned char[header.dataSize];
+
+				valid = fread(data, 1, header.dataSize, file) == header.dataSize && Hash(data, header.dataSize) == header.dataHash;
+			}
+
+			fclose(file);
+
+			try {
+				Init(valid ? data : nullptr, valid ? header.dataSize : 0);
+			}
+			catch (...) {
+				delete[] data;
+
+				throw;
+			}
+
+			delete[] data;
+		}
+
+		Cache::~Cache() {
+			if (!vkCache)
+				return;
+
+			vkDestroyPipelineCache(Device, vkCache, nullptr);
+
+			vkCache = nullptr;
+		}
+
+		bool Cache::Save(const char* path) const {
+			size_t size = 0;
+
+			VkResult result = vkGetPipelineCacheData(Device, vkCache, &size, nullptr);
+
+			if (result)
+				throw Exception("Failed to get pipeline cache data.", this, (Exception::Type)result);
+
+			unsigned char* data = new unsigned char[size];
+
+			result = vkGetPipelineCacheData(Device, vkCache, &size, data);
+
+			if (result) {
+				delete[] data;
+
+				throw Exception("Failed to get pipeline cache data.", this, (Exception::Type)result);
+			}
+
+			Header header = GetHeader();
+
+			header.dataSize = size;
+
+			header.dataHash = Hash(data, size);
+
+			static std::atomic<unsigned> saveCount = 0;
+
+			const SOV::size tempPathSize = strlen(path) + 32;
+
+			char* tempPath = new char[tempPathSize];
+
+			FILE* file = nullptr;
+
+			// Concurrent saves, also from other processes, each need their own temporary file. "x" fails instead of opening a
+			// file which already exists, in which case another name is tried.
+			for (unsigned i = 0; !file && i < 8; i++) {
+				const ACTL::u64 unique = (ACTL::u64)std::chrono::steady_clock::now().time_since_epoch().count() + saveCount++;
+
+				snprintf(tempPath, tempPathSize, "%s.%llx.tmp", path, (unsigned long long)unique);
+
+				file = fopen(tempPath, "wbx");
+			}
+
+			bool written = file
+				&& fwrite(&header, sizeof(Header), 1, file) == 1
+				&& fwrite(data, 1, size, file) == size;
+
+			if (file)
+				written = !fclose(file) && written;
+
+			// Renaming keeps a complete file at path even if the process dies while writing. Where rename does not replace an
+			// existing file, the old one is removed first as a fallback.
+			if (written && rename(tempPath, path)) {
+				remove(path);
+
+				written = !rename(tempPath, path);
+			}
+
+			if (file && !written)
+				remove(tempPath);
+
+			delete[] tempPath;
+
+			delete[] data;
+
+			return written;
+		}
+
+		void Cache::Init(const void* data, SOV::size size) {
+			VkPipelineCacheCreateInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+				.initialDataSize = size,
+				.pInitialData = data,
+			};
+
+			VkResult result = vkCreatePipelineCache(Device, &vkInfo, nullptr, &vkCache);
+
+			if (result)
+				throw Exception("Failed to create pipeline cache.", this, (Exception::Type)result);
+		}
+
+		Cache::Header Cache::GetHeader() const {
+			const PhysicalDevice::Info& info = Device.PhysicalDevice.info;
+
+			Header header = {
+				.magic = magic,
+				.vendorID = info.vendorID,
+				.deviceID = info.deviceID,
+				.driverVersion = info.driverVersion,
+			};
+
+			memcpy(header.uuid, info.pipelineCacheUUID, VK_UUID_SIZE);
+
+			return header;
+		}
+
+		Compute::Compute(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout, const Cache* Cache) : Device(Module.Device) {
+			const VkSpecializationInfo vkSpecialization = Specialization.GetInfo();
+
+			VkComputePipelineCreateInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+				.stage = {
+					.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+					.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+					.module = Module,
+					.pName = Module.getInfo().entryPointName,
+					.pSpecializationInfo = Specialization.isEmpty() ? nullptr : &vkSpecialization,
+				},
+				.layout = Layout,
+			};
+
+			VkResult result = vkCreateComputePipelines(Device, Cache ? (VkPipelineCache)*Cache : nullptr, 1, &vkInfo, nullptr, &vkPipeline);
+
+			if (result)
+				throw Exception("Failed to create compute pipeline.", this, (Exception::Type)result);
+		}
+
+		Compute::~Compute() {
+			if (!vkPipeline)
+				return;
+
+			vkDestroyPipeline(Device, vkPipeline, nullptr);
+
+			vkPipeline = nullptr;
+		}
+
+		Graphics::Graphics(const SOV::Device& Device, const ACTL::Array<const Graphics&>& Libraries, const Layout& Layout, bool optimize, const Cache* Cache) : Device(Device) {
+			if (!Device.getFeatures().graphicsPipelineLibrary)
+				throw Exception("graphicsPipelineLibrary feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			const unsigned libraryCount = (unsigned)Libraries.GetLength();
+
+			VkPipeline* vkLibraries = new VkPipeline[libraryCount];
+
+			for (unsigned i = 0; i < libraryCount; i++)
+				vkLibraries[i] = Libraries[i];
+
+			VkPipelineLibraryCreateInfoKHR vkLibraryInfo = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+				.libraryCount = libraryCount,
+				.pLibraries = vkLibraries,
+			};
+
+			VkGraphicsPipelineCreateInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+				.pNext = &vkLibraryInfo,
+				.flags = optimize ? (VkPipelineCreateFlags)VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0,
+				.layout = Layout,
+			};
+
+			VkResult result = vkCreateGraphicsPipelines(Device, Cache ? (VkPipelineCache)*Cache : nullptr, 1, &vkInfo, nullptr, &vkPipeline);
+
+			delete[] vkLibraries;
+
+			if (result)
+				throw Exception("Failed to link graphics pipeline.", this, (Exception::Type)result);
+		}
+
+		void Graphics::Init(const Info& info, const Layout& Layout, const Cache* Cache, const Part* part) {
+			if (!Device.getFeatures().dynamicRendering)
+				throw Exception("dynamicRendering feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			if (part && !Device.getFeatures().graphicsPipelineLibrary)
+				throw Exception("graphicsPipelineLibrary feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			const unsigned moduleCount = (unsigned)info.Modules.GetLength();
+
+			const unsigned bindingCount = (unsigned)info.vertexBindings.GetLength();
+
+			const unsigned attributeCount = (unsigned)info.vertexAttributes.GetLength();
+
+			const unsigned colorCount = (unsigned)info.colorFormats.GetLength();
+
+			VkPipelineShaderStageCreateInfo* vkStages = new VkPipelineShaderStageCreateInfo[moduleCount];
+
+			VkSpecializationInfo* vkSpecializations = new VkSpecializationInfo[moduleCount];
+
+			unsigned stageCount = 0;
+
+			for (unsigned i = 0; i < moduleCount; i++) {
+				const Shader::Module& Module = info.Modules[i];
+
+				// Libraries take the fragment stage with the fragment shader part and the others with the pre-rasterization part.
+				if (part && *part != (Module.getInfo().stageFlags == Shader::FRAGMENT ? FRAGMENT_SHADER : PRE_RASTERIZATION))
+					continue;
+
+				const bool specialized = i < info.Specializations.GetLength() && !info.Specializations[i].isEmpty();
+
+				if (specialized)
+					vkSpecializations[i] = info.Specializations[i].GetInfo();
+
+				vkStages[stageCount++] = {
+					.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+					.stage = (VkShaderStageFlagBits)Module.getInfo().stageFlags,
+					.module = Module,
+					.pName = Module.getInfo().entryPointName,
+					.pSpecializationInfo = specialized ? &vkSpecializations[i] : nullptr,
+				};
+			}
+
+			VkVertexInputBindingDescription* vkBindings = new VkVertexInputBindingDescription[bindingCount];
+
+			for (unsigned i = 0; i < bindingCount; i++)
+				vkBindings[i] = {
+					.binding = info.vertexBindings[i].binding,
+					.stride = info.vertexBindings[i].stride,
+					.inputRate = (VkVertexInputRate)info.vertexBindings[i].inputRate,
+				};
+
+			VkVertexInputAttributeDescription* vkAttributes = new VkVertexInputAttributeDescription[attributeCount];
+
+			for (unsigned i = 0; i < attributeCount; i++)
+				vkAttributes[i] = {
+					.location = info.vertexAttributes[i].location,
+					.binding = info.vertexAttributes[i].binding,
+					.format = (VkFormat)info.vertexAttributes[i].format,
+					.offset = info.vertexAttributes[i].offset,
+				};
+
+			VkPipelineColorBlendAttachmentState vkBlend = {
+				.blendEnable = info.blendMode != BlendMode::NONE,
+				.srcColorBlendFactor = VK_BLEND_FACTOR_ONE,
+				.dstColorBlendFactor = VK_BLEND_FACTOR_ZERO,
+				.colorBlendOp = VK_BLEND_OP_ADD,
+				.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE,
+				.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO,
+				.alphaBlendOp = VK_BLEND_OP_ADD,
+				.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT,
+			};
+
+			switch (info.blendMode) {
+			case BlendMode::ALPHA:
+				vkBlend.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+
+				vkBlend.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+
+				vkBlend.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+
+				break;
+
+			case BlendMode::PREMULTIPLIED_ALPHA:
+				vkBlend.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+
+				vkBlend.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+
+				break;
+
+			case BlendMode::ADDITIVE:
+				vkBlend.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+
+				vkBlend.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+
+				break;
+
+			default:
+				break;
+			}
+
+			VkPipelineColorBlendAttachmentState* vkBlends = new VkPipelineColorBlendAttachmentState[colorCount];
+
+			VkFormat* vkColorFormats = new VkFormat[colorCount];
+
+			for (unsigned i = 0; i < colorCount; i++) {
+				vkBlends[i] = vkBlend;
+
+				vkColorFormats[i] = (VkFormat)info.colorFormats[i];
+			}
+
+			VkPipelineVertexInputStateCreateInfo vkVertexInput = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+				.vertexBindingDescriptionCount = bindingCount,
+				.pVertexBindingDescriptions = vkBindings,
+				.vertexAttributeDescriptionCount = attributeCount,
+				.pVertexAttributeDescriptions = vkAttributes,
+			};
+
+			VkPipelineInputAssemblyStateCreateInfo vkInputAssembly = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+				.topology = (VkPrimitiveTopology)info.topology,
+			};
+
+			VkPipelineViewportStateCreateInfo vkViewport = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+				.viewportCount = 1,
+				.scissorCount = 1,
+			};
+
+			VkPipelineRasterizationStateCreateInfo vkRasterization = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+				.polygonMode = (VkPolygonMode)info.polygonMode,
+				.cullMode = (VkCullModeFlags)info.cullMode,
+				.frontFace = (VkFrontFace)info.frontFace,
+				.lineWidth = 1.0f,
+			};
+
+			VkPipelineMultisampleStateCreateInfo vkMultisample = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+				.rasterizationSamples = (VkSampleCountFlagBits)info.sampleCount,
+			};
+
+			VkPipelineDepthStencilStateCreateInfo vkDepthStencil = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+				.depthTestEnable = info.depthTest,
+				.depthWriteEnable = info.depthWrite,
+				.depthCompareOp = (VkCompareOp)info.depthCompareOp,
+			};
+
+			VkPipelineColorBlendStateCreateInfo vkColorBlend = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+				.attachmentCount = colorCount,
+				.pAttachments = vkBlends,
+			};
+
+			VkDynamicState vkDynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+
+			VkPipelineDynamicStateCreateInfo vkDynamic = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+				.dynamicStateCount = 2,
+				.pDynamicStates = vkDynamicStates,
+			};
+
+			VkPipelineRenderingCreateInfo vkRendering = {
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+				.colorAttachmentCount = colorCount,
+				.pColorAttachmentFormats = vkColorFormats,
+				.depthAttachmentFormat = (VkFormat)info.depthFormat,
+				.stencilAttachmentFormat = (VkFormat)info.stencilFormat,
+			};
+
+			// State outside of the part is ignored.
+			VkGraphicsPipelineLibraryCreateInfoEXT vkLibrary = {
+				.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+				.pNext = &vkRendering,
+				.flags = part ? (VkGraphicsPipelineLibraryFlagsEXT)*part : 0,
+			};
+
+			VkGraphicsPipelineCreateInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+				.pNext = part ? (const void*)&vkLibrary : &vkRendering,
+				.flags = part ? (VkPipelineCreateFlags)(VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT) : 0,
+				.stageCount = stageCount,
+				.pStages = vkStages,
+				.pVertexInputState = &vkVertexInput,
+				.pInputAssemblyState = &vkInputAssembly,
+				.pViewportState = &vkViewport,
+				.pRasterizationState = &vkRasterization,
+				.pMultisampleState = &vkMultisample,
+				.pDepthStencilState = &vkDepthStencil,
+				.pColorBlendState = &vkColorBlend,
+				.pDynamicState = &vkDynamic,
+				.layout = Layout,
+			};
+
+			VkResult result = vkCreateGraphicsPipelines(Device, Cache ? (VkPipelineCache)*Cache : nullptr, 1, &vkInfo, nullptr, &vkPipeline);
+
+			delete[] vkStages;
+
+			delete[] vkSpecializations;
+
+			delete[] vkBindings;
+
+			delete[] vkAttributes;
+
+			delete[] vkBlends;
+
+			delete[] vkColorFormats;
+
+			if (result)
+				throw Exception("Failed to create graphics pipeline.", this, (Exception::Type)result);
+		}
+
+		Graphics::~Graphics() {
+			if (!vkPipeline)
+				return;
+
+			vkDestroyPipeline(Device, vkPipeline, nullptr);
+
+			vkPipeline = nullptr;
+		}
+
+		Key::Key(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout) {
+			Append('C');
+
+			Append(Layout);
+
+			Append(Module);
+
+			Append(Specialization);
+
+			hash = Hash(bytes.begin(), bytes.GetLength());
+		}
+
+		Key::Key(const Graphics::Info& info, const Layout& Layout) {
+			Append('G');
+
+			for (Graphics::Part part : Graphics::parts)
+				Append(part, info, Layout);
+
+			hash = Hash(bytes.begin(), bytes.GetLength());
+		}
+
+		Key::Key(Graphics::Part part, const Graphics::Info& info, const Layout& Layout) {
+			Append('P');
+
+			Append(part, info, Layout);
+
+			hash = Hash(bytes.begin(), bytes.GetLength());
+		}
+
+		Key::Key(const ACTL::Array<Descriptor::Set::Layout&>& SetLayouts, const ACTL::Array<Layout::PushConstantRange>& pushConstantRanges) {
+			Append('L');
+
+			Append((unsigned)SetLayouts.GetLength());
+
+			for (const Descriptor::Set::Layout& SetLayout : SetLayouts)
+				Append(SetLayout.getBindings(), SetLayout.getFlags());
+
+			Append((unsigned)pushConstantRanges.GetLength());
+
+			for (auto& range : pushConstantRanges) {
+				Append(range.shaderStageFlags);
+
+				Append(range.offset);
+
+				Append(range.size);
+			}
+
+			hash = Hash(bytes.begin(), bytes.GetLength());
+		}
+
+		Key::Key(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings, Descriptor::Set::Layout::Flag flags) {
+			Append('S');
+
+			Append(bindings, flags);
+
+			hash = Hash(bytes.begin(), bytes.GetLength());
+		}
+
+		bool Key::operator ==(const Key& Other) const {
+			return hash == Other.hash
+				&& bytes.GetLength() == Other.bytes.GetLength()
+				&& !memcmp(bytes.begin(), Other.bytes.begin(), bytes.GetLength());
+		}
+
+		void Key::Append(const void* data, SOV::size size) {
+			if (bytes.GetCapacity() < bytes.GetLength() + size)
+				bytes.SetCapacity((bytes.GetLength() + size) * 2);
+
+			for (SOV::size i = 0; i < size; i++)
+				bytes.EmplaceBack(((const unsigned char*)data)[i]);
+		}
+
+		void Key::Append(const Layout& Layout) {
+			const Key& key = Layout.getKey();
+
+			Append(key.bytes.begin(), key.bytes.GetLength());
+		}
+
+		void Key::Append(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings, Descriptor::Set::Layout::Flag flags) {
+			const unsigned bindingCount = (unsigned)bindings.GetLength();
+
+			Append(flags);
+
+			Append(bindingCount);
+
+			// Most layouts have few bindings, those are ordered on the stack.
+			unsigned localOrder[localBindingCount];
+
+			unsigned* order = bindingCount <= localBindingCount ? localOrder : new unsigned[bindingCount];
+
+			// Insertion sort, binding lists are short.
+			for (unsigned i = 0; i < bindingCount; i++) {
+				unsigned j = i;
+
+				for (; j > 0 && bindings[order[j - 1]].binding > bindings[i].binding; j--)
+					order[j] = order[j - 1];
+
+				order[j] = i;
+			}
+
+			for (unsigned i = 0; i < bindingCount; i++) {
+				auto& binding = bindings[order[i]];
+
+				Append(binding.binding);
+
+				Append(binding.descriptorType);
+
+				Append(binding.descriptorCount);
+
+				Append(binding.shaderStageFlags);
+
+				Append(binding.flags);
+			}
+
+			if (order != localOrder)
+				delete[] order;
+		}
+
+		void Key::Append(const Shader::Module& Module) {
+			const char* entryPointName = Module.getInfo().entryPointName;
+
+			Append(Module.getHash());
+
+			Append(Module.getInfo().stageFlags);
+
+			Append(entryPointName, strlen(entryPointName) + 1);
+		}
+
+		void Key::Append(Graphics::Part part, const Graphics::Info& info, const Layout& Layout) {
+			Append(part);
+
+			switch (part) {
+			case Graphics::VERTEX_INPUT:
+				Append((unsigned)info.vertexBindings.GetLength());
+
+				for (auto& binding : info.vertexBindings) {
+					Append(binding.binding);
+
+					Append(binding.stride);
+
+					Append(binding.inputRate);
+				}
+
+				Append((unsigned)info.vertexAttributes.GetLength());
+
+				for (auto& attribute : info.vertexAttributes) {
+					Append(attribute.location);
+
+					Append(attribute.binding);
+
+					Append(attribute.format);
+
+					Append(attribute.offset);
+				}
+
+				Append(info.topology);
+
+				break;
+
+			case Graphics::PRE_RASTERIZATION:
+			case Graphics::FRAGMENT_SHADER:
+				Append(Layout);
+
+				for (unsigned i = 0; i < info.Modules.GetLength(); i++) {
+					if ((info.Modules[i].getInfo().stageFlags == Shader::FRAGMENT) != (part == Graphics::FRAGMENT_SHADER))
+						continue;
+
+					Append(info.Modules[i]);
+
+					Append(i < info.Specializations.GetLength() ? info.Specializations[i] : Shader::Specialization());
+				}
+
+				if (part == Graphics::PRE_RASTERIZATION) {
+					Append(info.polygonMode);
+
+					Append(info.cullMode);
+
+					Append(info.frontFace);
+				}
+				else {
+					Append(info.sampleCount);
+
+					Append(info.depthTest);
+
+					Append(info.depthWrite);
+
+					Append(info.depthCompareOp);
+				}
+
+				break;
+
+			case Graphics::FRAGMENT_OUTPUT:
+				Append(info.sampleCount);
+
+				Append(info.blendMode);
+
+				Append((unsigned)info.colorFormats.GetLength());
+
+				for (auto format : info.colorFormats)
+					Append(format);
+
+				Append(info.depthFormat);
+
+				Append(info.stencilFormat);
+
+				break;
+			}
+		}
+
+		void Key::Append(const Shader::Specialization& Specialization) {
+			Append((unsigned)Specialization.getEntries().GetLength());
+
+			for (auto& entry : Specialization.getEntries()) {
+				Append(entry.constantID);
+
+				Append((unsigned)entry.size);
+
+				Append(Specialization.getData().begin() + entry.offset, entry.size);
+			}
+		}
+	}
+}
\ No newline at end of file
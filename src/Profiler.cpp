@@ -0,0 +1,119 @@
+#include "Source.hpp"
+
+#include <string.h>
+
+namespace SOV {
+	Profiler::Profiler(const SOV::Device& Device, const Queue::Family& family, unsigned frameCount, unsigned maxScopeCount) :
+		Device(Device),
+		frameCount(frameCount),
+		maxScopeCount(maxScopeCount),
+		Pool(Device, {
+			.type = Query::Type::TIMESTAMP,
+			.count = frameCount * maxScopeCount * 2,
+		}),
+		frames(frameCount) {
+		if (!family.timestampValidBits)
+			throw Exception("Queue family does not support timestamps.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+		for (unsigned i = 0; i < frameCount; i++)
+			frames.EmplaceBack(Frame()).labels.SetCapacity(maxScopeCount);
+
+		results = new ACTL::u64[maxScopeCount * 2];
+
+		timestampMask = family.timestampValidBits >= 64 ? ~0ull : (1ull << family.timestampValidBits) - 1;
+	}
+
+	Profiler::~Profiler() {
+		delete[] results;
+
+		results = nullptr;
+	}
+
+	void Profiler::BeginFrame(const Command::Buffer& Buffer) {
+		currentFrame = (currentFrame + 1) % frameCount;
+
+		Frame& frame = frames[currentFrame];
+
+		const unsigned firstQuery = currentFrame * maxScopeCount * 2;
+
+		if (frame.pending)
+			Resolve(frame, firstQuery);
+
+		frame.labels.Clear();
+
+		frame.pending = true;
+
+		Buffer.ResetQueryPool(Pool, firstQuery, maxScopeCount * 2);
+	}
+
+	unsigned Profiler::Allocate(const char* label) {
+		Frame& frame = frames[currentFrame];
+
+		if (!frame.pending || frame.labels.GetLength() == maxScopeCount)
+			return ~0u;
+
+		const unsigned query = (currentFrame * maxScopeCount + (unsigned)frame.labels.GetLength()) * 2;
+
+		frame.labels.EmplaceBack(label);
+
+		return query;
+	}
+
+	void Profiler::Resolve(Frame& frame, unsigned firstQuery) {
+		const unsigned scopeCount = (unsigned)frame.labels.GetLength();
+
+		if (!scopeCount)
+			return;
+
+		const bool ready = Pool.GetResults(
+			firstQuery,
+			scopeCount * 2,
+			scopeCount * 2 * sizeof(ACTL::u64),
+			results,
+			sizeof(ACTL::u64),
+			Query::RESULT_64
+		);
+
+		// GPU is more than frameCount frames behind, results of this frame are dropped.
+		if (!ready)
+			return;
+
+		const double period = Device.PhysicalDevice.info.timestampPeriod;
+
+		for (unsigned i = 0; i < scopeCount; i++) {
+			const ACTL::u64 ticks = (results[i * 2 + 1] - results[i * 2]) & timestampMask;
+
+			Accumulate(frame.labels[i], (double)ticks * period / 1000000.0);
+		}
+	}
+
+	void Profiler::Accumulate(const char* label, double time) {
+		for (auto& entry : statistics) {
+			if (entry.label != label && strcmp(entry.label, label))
+				continue;
+
+			entry.count++;
+
+			entry.last = time;
+
+			entry.average += (time - entry.average) / entry.count;
+
+			if (time < entry.min)
+				entry.min = time;
+
+			if (time > entry.max)
+				entry.max = time;
+
+			return;
+		}
+
+		statistics.EmplaceBack(Statistics{
+			.label = label,
+			.count = 1,
+			.last = time,
+			.average = time,
+			.min = time,
+			.max = time,
+		});
+	}
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "Source.hpp"
+
+namespace SOV {
+	namespace Query {
+		Pool::Pool(const SOV::Device& Device, const Info& info) : Device(Device), type(info.type), count(info.count) {
+			if (info.type == Type::PIPELINE_STATISTICS && !Device.getFeatures().pipelineStatisticsQuery)
+				throw Exception("pipelineStatisticsQuery feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+			VkQueryPoolCreateInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+				.queryType = (VkQueryType)info.type,
+				.queryCount = info.count,
+				.pipelineStatistics = (VkQueryPipelineStatisticFlags)info.pipelineStatisticFlags,
+			};
+
+			VkResult result = vkCreateQueryPool(Device, &vkInfo, nullptr, &vkPool);
+
+			if (result)
+				throw Exception("Failed to create query pool.", this, (Exception::Type)result);
+		}
+
+		Pool::~Pool() {
+			if (!vkPool)
+				return;
+
+			vkDestroyQueryPool(Device, vkPool, nullptr);
+
+			vkPool = nullptr;
+		}
+
+		bool Pool::GetResults(
+			unsigned firstQuery,
+			unsigned queryCount,
+			SOV::size dataSize,
+			void* data,
+			SOV::size stride,
+			ResultFlag resultFlags
+		) const {
+			VkResult result = vkGetQueryPoolResults(
+				Device,
+				vkPool,
+				firstQuery,
+				queryCount,
+				dataSize,
+				data,
+				stride,
+				(VkQueryResultFlags)resultFlags
+			);
+
+			if (result == VK_NOT_READY)
+				return false;
+
+			if (result)
+				throw Exception("Failed to get query pool results.", this, (Exception::Type)result);
+
+			return true;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include "Source.hpp"
+
+namespace SOV {
+	namespace Pipeline {
+		Registry::~Registry() {
+			for (auto& pair : entries)
+				Delete(pair.second);
+		}
+
+		Registry::Reference<Descriptor::Set::Layout> Registry::GetSetLayout(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings) {
+			return GetSetLayout(bindings, Descriptor::Set::Layout::NONE);
+		}
+
+		Registry::Reference<Descriptor::Set::Layout> Registry::GetSetLayout(const ACTL::Array<Descriptor::Set::Layout::Binding>& bindings, Descriptor::Set::Layout::Flag flags) {
+			return Get(Key(bindings, flags), &Entry::SetLayoutObject, [&] {
+				return new Descriptor::Set::Layout(Device, bindings, flags);
+			});
+		}
+
+		Registry::Reference<Layout> Registry::GetLayout(const ACTL::Array<Descriptor::Set::Layout&>& SetLayouts, const ACTL::Array<Layout::PushConstantRange>& pushConstantRanges) {
+			return Get(Key(SetLayouts, pushConstantRanges), &Entry::LayoutObject, [&] {
+				return new Layout(Device, SetLayouts, pushConstantRanges);
+			});
+		}
+
+		Registry::Reference<Layout> Registry::GetLayout(const ACTL::Array<Reference<Descriptor::Set::Layout>>& SetLayouts, const ACTL::Array<Layout::PushConstantRange>& pushConstantRanges) {
+			ACTL::Array<Descriptor::Set::Layout&> Layouts;
+
+			Layouts.SetCapacity(SetLayouts.GetLength());
+
+			for (auto& SetLayout : SetLayouts)
+				Layouts.EmplaceBack(*SetLayout.entry->SetLayoutObject);
+
+			Key key(Layouts, pushConstantRanges);
+
+			{
+				std::lock_guard lock(mutex);
+
+				if (Entry* entry = Find(key))
+					return {this, entry, entry->LayoutObject};
+			}
+
+			Layout* object = new Layout(Device, Layouts, pushConstantRanges);
+
+			Entry* entry = nullptr;
+
+			{
+				std::lock_guard lock(mutex);
+
+				entry = Find(key);
+
+				if (!entry) {
+					entry = Insert(ACTL::move(key));
+
+					entry->LayoutObject = object;
+
+					entry->dependencies.SetCapacity(SetLayouts.GetLength());
+
+					for (auto& SetLayout : SetLayouts) {
+						SetLayout.entry->referenceCount++;
+
+						entry->dependencies.EmplaceBack(SetLayout.entry);
+					}
+
+					return {this, entry, object};
+				}
+			}
+
+			delete object;
+
+			return {this, entry, entry->LayoutObject};
+		}
+
+		Registry::Reference<Compute> Registry::GetCompute(const Shader::Module& Module, const Layout& Layout) {
+			return GetCompute(Module, {}, Layout);
+		}
+
+		Registry::Reference<Compute> Registry::GetCompute(const Shader::Module& Module, const Shader::Specialization& Specialization, const Layout& Layout) {
+			return Get(Key(Module, Specialization, Layout), &Entry::ComputeObject, [&] {
+				return new Compute(Module, Specialization, Layout, Cache);
+			});
+		}
+
+		Registry::Reference<Graphics> Registry::GetGraphics(const Graphics::Info& info, const Layout& Layout) {
+			return Get(Key(info, Layout), &Entry::GraphicsObject, [&] {
+				return new Graphics(Device, info, Layout, Cache);
+			});
+		}
+
+		SOV::size Registry::GetCount() const {
+			std::lock_guard lock(mutex);
+
+			return entries.size();
+		}
+
+		template <typename Type, typename Create>
+		Registry::Reference<Type> Registry::Get(Key&& key, Type* Entry::* member, const Create& create) {
+			{
+				std::lock_guard lock(mutex);
+
+				if (Entry* entry = Find(key))
+					return {this, entry, entry->*member};
+			}
+
+			Type* object = create();
+
+			Entry* entry = nullptr;
+
+			{
+				std::lock_guard lock(mutex);
+
+				entry = Find(key);
+
+				if (!entry) {
+					entry = Insert(ACTL::move(key));
+
+					entry->*member = object;
+
+					return {this, entry, object};
+				}
+			}
+
+			// Another thread created an equal object meanwhile.
+			delete object;
+
+			return {this, entry, entry->*member};
+		}
+
+		Registry::Entry* Registry::Find(const Key& key) {
+			auto range = entries.equal_range(key.GetHash());
+
+			for (auto i = range.first; i != range.second; i++)
+				if (i->second->key == key) {
+					i->second->referenceCount++;
+
+					return i->second;
+				}
+
+			return nullptr;
+		}
+
+		Registry::Entry* Registry::Insert(Key&& key) {
+			Entry* entry = new Entry{
+				.key = ACTL::move(key),
+			};
+
+			entries.emplace(entry->key.GetHash(), entry);
+
+			return entry;
+		}
+
+		void Registry::AddReference(Entry* entry) {
+			std::lock_guard lock(mutex);
+
+			entry->referenceCount++;
+		}
+
+		void Registry::Release(Entry* entry) {
+			{
+				std::lock_guard lock(mutex);
+
+				if (--entry->referenceCount)
+					return;
+
+				auto range = entries.equal_range(entry->key.GetHash());
+
+				for (auto i = range.first; i != range.second; i++)
+					if (i->second == entry) {
+						entries.erase(i);
+
+						break;
+					}
+			}
+
+			ACTL::Array<Entry*> dependencies = ACTL::move(entry->dependencies);
+
+			Delete(entry);
+
+			for (Entry* dependency : dependencies)
+				Release(dependency);
+		}
+
+		void Registry::Delete(Entry* entry) {
+			delete entry->SetLayoutObject;
+
+			delete entry->LayoutObject;
+
+			delete entry->ComputeObject;
+
+			delete entry->GraphicsObject;
+
+			delete entry;
+		}
+	}
+}
\ No newline at end of file
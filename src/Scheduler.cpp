@@ -0,0 +1,139 @@
+#include "Source.hpp"
+
+namespace SOV {
+	Scheduler::Scheduler(const SOV::Device& Device, unsigned workerCount) : Device(Device), Wake(Device, Semaphore::Type::TIMELINE, 0) {
+		workers.SetCapacity(workerCount);
+
+		for (unsigned i = 0; i < workerCount; i++)
+			workers.EmplaceBack(std::thread(&Scheduler::Work, this));
+
+		watcher = std::thread(&Scheduler::Watch, this);
+	}
+
+	Scheduler::~Scheduler() {
+		{
+			std::lock_guard lock(mutex);
+
+			stopping = true;
+
+			Wake.Signal(++wakeValue);
+		}
+
+		condition.notify_all();
+
+		watcher.join();
+
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+	void Scheduler::Schedule(const Semaphore& Timeline, ACTL::u64 value, Job job) {
+		std::lock_guard lock(mutex);
+
+		pending.EmplaceBack(Pending{
+			.vkSemaphore = Timeline,
+			.value = value,
+			.job = ACTL::move(job),
+		});
+
+		Wake.Signal(++wakeValue);
+	}
+
+	void Scheduler::Schedule(Job job) {
+		{
+			std::lock_guard lock(mutex);
+
+			ready.EmplaceBack(ACTL::move(job));
+		}
+
+		condition.notify_one();
+	}
+
+	void Scheduler::Watch() {
+		ACTL::Array<VkSemaphore> vkSemaphores;
+
+		ACTL::Array<ACTL::u64> values;
+
+		std::unique_lock lock(mutex);
+
+		while (!stopping) {
+			for (SOV::size i = 0; i < pending.GetLength();) {
+				ACTL::u64 value = 0;
+
+				VkResult result = vkGetSemaphoreCounterValue(Device, pending[i].vkSemaphore, (uint64_t*)&value);
+
+				// Device lost, pending jobs can never become ready.
+				if (result)
+					return;
+
+				if (value < pending[i].value) {
+					i++;
+
+					continue;
+				}
+
+				ready.EmplaceBack(ACTL::move(pending[i].job));
+
+				condition.notify_one();
+
+				if (i != pending.GetLength() - 1)
+					pending[i] = ACTL::move(pending[pending.GetLength() - 1]);
+
+				pending.EraseBack();
+			}
+
+			vkSemaphores.Clear();
+
+			values.Clear();
+
+			vkSemaphores.EmplaceBack((VkSemaphore)Wake);
+
+			values.EmplaceBack(wakeValue + 1);
+
+			for (auto& entry : pending) {
+				vkSemaphores.EmplaceBack(entry.vkSemaphore);
+
+				values.EmplaceBack(entry.value);
+			}
+
+			VkSemaphoreWaitInfo vkInfo = {
+				.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+				.flags = VK_SEMAPHORE_WAIT_ANY_BIT,
+				.semaphoreCount = (unsigned)vkSemaphores.GetLength(),
+				.pSemaphores = vkSemaphores.begin(),
+				.pValues = (const uint64_t*)values.begin(),
+			};
+
+			lock.unlock();
+
+			VkResult result = vkWaitSemaphores(Device, &vkInfo, ~0ull);
+
+			lock.lock();
+
+			// Device lost, pending jobs can never become ready.
+			if (result && result != VK_TIMEOUT)
+				break;
+		}
+	}
+
+	void Scheduler::Work() {
+		std::unique_lock lock(mutex);
+
+		while (true) {
+			condition.wait(lock, [this] { return stopping || !ready.isEmpty(); });
+
+			if (ready.isEmpty())
+				return;
+
+			Job job = ACTL::move(*ready.First());
+
+			ready.EraseFront();
+
+			lock.unlock();
+
+			job();
+
+			lock.lock();
+		}
+	}
+}
\ No newline at end of file
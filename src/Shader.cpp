@@ -1,8 +1,13 @@
 #include "Source.hpp"
 
+#include <string.h>
+
 namespace SOV {
 	namespace Shader {
-		Module::Module(const SOV::Device& Device, ACTL::Array<unsigned> code, const Info& info) : Device(Device), info(info) {
+		Module::Module(const SOV::Device& Device, ACTL::Array<unsigned> code, const Info& info) :
+			Device(Device),
+			info(info),
+			hash(Hash(code.begin(), code.GetLength() * 4)) {
 			VkShaderModuleCreateInfo vkInfo = {
 				.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
 				.codeSize = (unsigned)code.GetLength() * 4,
@@ -23,5 +28,32 @@ namespace SOV {
 
 			vkModule = nullptr;
 		}
+
+		void Specialization::Set(unsigned constantID, const void* value, SOV::size size) {
+			VkSpecializationMapEntry* entry = nullptr;
+
+			for (auto& existing : entries)
+				if (existing.constantID == constantID)
+					entry = &existing;
+
+			if (entry && entry->size == size) {
+				memcpy(data.begin() + entry->offset, value, size);
+
+				return;
+			}
+
+			if (!entry)
+				entry = &entries.EmplaceBack(VkSpecializationMapEntry{
+					.constantID = constantID,
+				});
+
+			// A resized constant gets new bytes, the old ones stay unused.
+			entry->offset = (unsigned)data.GetLength();
+
+			entry->size = size;
+
+			for (SOV::size i = 0; i < size; i++)
+				data.EmplaceBack(((const unsigned char*)value)[i]);
+		}
 	}
 }
\ No newline at end of file
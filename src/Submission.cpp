@@ -0,0 +1,136 @@
+#include "Source.hpp"
+
+namespace SOV {
+	void Queue::Batch::Wait(const Semaphore& Semaphore, ACTL::u64 value, Pipeline::StageFlag stageFlags) {
+		GetOpenSubmit().waitCount++;
+
+		vkWaits.EmplaceBack(VkSemaphoreSubmitInfo{
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+			.semaphore = Semaphore,
+			.value = value,
+			.stageMask = (VkPipelineStageFlags2)stageFlags,
+		});
+	}
+
+	void Queue::Batch::WaitAll(const Semaphore& Semaphore, ACTL::u64 value, Pipeline::StageFlag stageFlags) {
+		const VkSemaphoreSubmitInfo vkWait = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+			.semaphore = Semaphore,
+			.value = value,
+			.stageMask = (VkPipelineStageFlags2)stageFlags,
+		};
+
+		const unsigned submitCount = (unsigned)submits.GetLength();
+
+		for (unsigned i = 0; i < submitCount; i++)
+			vkWaits.EmplaceBack(vkWait);
+
+		// Submission i moves up by i entries to make room for the waits added before it, moving back to front never
+		// overwrites entries which were not moved yet.
+		for (unsigned i = submitCount; i-- > 0;) {
+			Entry& submit = submits[i];
+
+			for (unsigned j = submit.waitCount; j-- > 0;)
+				vkWaits[submit.firstWait + i + j] = vkWaits[submit.firstWait + j];
+
+			vkWaits[submit.firstWait + i + submit.waitCount] = vkWait;
+
+			submit.firstWait += i;
+
+			submit.waitCount++;
+		}
+	}
+
+	void Queue::Batch::Execute(const Command::Buffer& Buffer) {
+		GetOpenSubmit().commandBufferCount++;
+
+		vkCommandBuffers.EmplaceBack(VkCommandBufferSubmitInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+			.commandBuffer = Buffer,
+		});
+	}
+
+	void Queue::Batch::Signal(const Semaphore& Semaphore, ACTL::u64 value, Pipeline::StageFlag stageFlags) {
+		if (submits.isEmpty())
+			Begin();
+
+		submits[submits.GetLength() - 1].signalCount++;
+
+		vkSignals.EmplaceBack(VkSemaphoreSubmitInfo{
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+			.semaphore = Semaphore,
+			.value = value,
+			.stageMask = (VkPipelineStageFlags2)stageFlags,
+		});
+	}
+
+	const VkSubmitInfo2* Queue::Batch::Build() {
+		vkSubmits.Clear();
+
+		if (vkSubmits.GetCapacity() < submits.GetLength())
+			vkSubmits.SetCapacity(submits.GetLength());
+
+		for (auto& submit : submits)
+			vkSubmits.EmplaceBack(VkSubmitInfo2{
+				.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+				.waitSemaphoreInfoCount = submit.waitCount,
+				.pWaitSemaphoreInfos = vkWaits.begin() + submit.firstWait,
+				.commandBufferInfoCount = submit.commandBufferCount,
+				.pCommandBufferInfos = vkCommandBuffers.begin() + submit.firstCommandBuffer,
+				.signalSemaphoreInfoCount = submit.signalCount,
+				.pSignalSemaphoreInfos = vkSignals.begin() + submit.firstSignal,
+			});
+
+		return vkSubmits.begin();
+	}
+
+	void Queue::Submit(Batch& Batch) const {
+		VkResult result = vkQueueSubmit2(vkQueue, (unsigned)Batch.submits.GetLength(), Batch.Build(), nullptr);
+
+		Batch.Clear();
+
+		if (result)
+			throw Exception("Failed to submit to queue.", this, (Exception::Type)result);
+	}
+
+	void Queue::Submit(Batch& Batch, const Fence& Fence) const {
+		VkResult result = vkQueueSubmit2(vkQueue, (unsigned)Batch.submits.GetLength(), Batch.Build(), Fence);
+
+		Batch.Clear();
+
+		if (result)
+			throw Exception("Failed to submit to queue.", this, (Exception::Type)result);
+	}
+
+	bool Queue::Present(const Swapchain& Swapchain, unsigned imageIndex, const Semaphore& WaitSemaphore) const {
+		VkSemaphore vkWaitSemaphore = WaitSemaphore;
+
+		VkSwapchainKHR vkSwapchain = Swapchain;
+
+		VkPresentInfoKHR vkInfo = {
+			.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+			.waitSemaphoreCount = 1,
+			.pWaitSemaphores = &vkWaitSemaphore,
+			.swapchainCount = 1,
+			.pSwapchains = &vkSwapchain,
+			.pImageIndices = &imageIndex,
+		};
+
+		VkResult result = vkQueuePresentKHR(vkQueue, &vkInfo);
+
+		if (result == VK_SUBOPTIMAL_KHR || result == VK_ERROR_OUT_OF_DATE_KHR)
+			return false;
+
+		if (result)
+			throw Exception("Failed to present swapchain image.", this, (Exception::Type)result);
+
+		return true;
+	}
+
+	void Queue::WaitIdle() const {
+		VkResult result = vkQueueWaitIdle(vkQueue);
+
+		if (result)
+			throw Exception("Failed to wait for queue idle.", this, (Exception::Type)result);
+	}
+}
\ No newline at end of file
@@ -10,9 +10,108 @@ namespace SOV {
 		vkFence = nullptr;
 	}
 
-	void Fence::Init(Flag flags) {
+	bool Fence::Wait(const SOV::Device& Device, const ACTL::Array<const Fence&>& Fences, bool waitAll, ACTL::u64 timeout) {
+		// vkWaitForFences needs at least one fence.
+		if (Fences.GetLength() == 0)
+			return true;
+
+		VkFence* vkFences = new VkFence[Fences.GetLength()];
+
+		for (SOV::size i = 0; i < Fences.GetLength(); i++)
+			vkFences[i] = Fences[i];
+
+		VkResult result = vkWaitForFences(Device, (unsigned)Fences.GetLength(), vkFences, waitAll, timeout);
+
+		delete[] vkFences;
+
+		if (result == VK_TIMEOUT)
+			return false;
+
+		if (result)
+			throw Exception("Failed to wait for fences.", &Device, (Exception::Type)result);
+
+		return true;
+	}
+
+	void Fence::Reset(const SOV::Device& Device, const ACTL::Array<const Fence&>& Fences) {
+		if (Fences.GetLength() == 0)
+			return;
+
+		VkFence* vkFences = new VkFence[Fences.GetLength()];
+
+		for (SOV::size i = 0; i < Fences.GetLength(); i++)
+			vkFences[i] = Fences[i];
+
+		VkResult result = vkResetFences(Device, (unsigned)Fences.GetLength(), vkFences);
+
+		delete[] vkFences;
+
+		if (result)
+			throw Exception("Failed to reset fences.", &Device, (Exception::Type)result);
+	}
+
+	bool Fence::Wait(ACTL::u64 timeout) const {
+		VkResult result = vkWaitForFences(Device, 1, &vkFence, VK_TRUE, timeout);
+
+		if (result == VK_TIMEOUT)
+			return false;
+
+		if (result)
+			throw Exception("Failed to wait for fence.", this, (Exception::Type)result);
+
+		return true;
+	}
+
+	void Fence::Reset() const {
+		VkResult result = vkResetFences(Device, 1, &vkFence);
+
+		if (result)
+			throw Exception("Failed to reset fence.", this, (Exception::Type)result);
+	}
+
+	bool Fence::GetStatus() const {
+		VkResult result = vkGetFenceStatus(Device, vkFence);
+
+		if (result == VK_NOT_READY)
+			return false;
+
+		if (result)
+			throw Exception("Failed to get fence status.", this, (Exception::Type)result);
+
+		return true;
+	}
+
+	int Fence::ExportFd(HandleType handleType) const {
+		auto vkGetFenceFdKHR = Device.getFunctions().vkGetFenceFdKHR;
+
+		if (!vkGetFenceFdKHR)
+			throw Exception("VK_KHR_external_fence_fd is not enabled.", this, Exception::Type::EXTENSION_NOT_PRESENT);
+
+		VkFenceGetFdInfoKHR vkInfo = {
+			.sType = VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR,
+			.fence = vkFence,
+			.handleType = (VkExternalFenceHandleTypeFlagBits)handleType,
+		};
+
+		int fd = -1;
+
+		VkResult result = vkGetFenceFdKHR(Device, &vkInfo, &fd);
+
+		if (result)
+			throw Exception("Failed to export fence.", this, (Exception::Type)result);
+
+		return fd;
+	}
+
+	void Fence::Init(Flag flags, HandleType exportTypes) {
+		VkExportFenceCreateInfo vkExportInfo = {
+			.sType = VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO,
+			.handleTypes = (VkExternalFenceHandleTypeFlags)exportTypes,
+		};
+
 		VkFenceCreateInfo vkInfo = {
 			.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+			.pNext = exportTypes ? &vkExportInfo : nullptr,
 			.flags = (VkFenceCreateFlags)flags
 		};
 
@@ -22,9 +121,139 @@ namespace SOV {
 			throw Exception("Failed to create fence.", this, (Exception::Type)result);
 	}
 
-	Semaphore::Semaphore(const SOV::Device& Device) : Device(Device) {
+	Fence& Fence::Pool::Acquire() {
+		if (available.GetLength() == 0)
+			Recycle();
+
+		if (available.GetLength() == 0)
+			return *fences.EmplaceBack(Device);
+
+		Fence& Fence = available[available.GetLength() - 1];
+
+		available.EraseBack();
+
+		return Fence;
+	}
+
+	void Fence::Pool::Release(Fence& Fence) {
+		released.EmplaceBack(Fence);
+	}
+
+	void Fence::Pool::Recycle() {
+		vkResets.Clear();
+
+		for (Fence& Fence : released) {
+			vkResets.EmplaceBack((VkFence)Fence);
+
+			available.EmplaceBack(Fence);
+		}
+
+		released.Clear();
+
+		// vkResetFences needs at least one fence.
+		if (vkResets.GetLength() == 0)
+			return;
+
+		VkResult result = vkResetFences(Device, (unsigned)vkResets.GetLength(), vkResets.begin());
+
+		if (result)
+			throw Exception("Failed to reset fences.", this, (Exception::Type)result);
+	}
+
+	Semaphore::~Semaphore() {
+		if (!vkSemaphore)
+			return;
+
+		vkDestroySemaphore(Device, vkSemaphore, nullptr);
+
+		vkSemaphore = nullptr;
+	}
+
+	ACTL::u64 Semaphore::GetValue() const {
+		ACTL::u64 value;
+
+		VkResult result = vkGetSemaphoreCounterValue(Device, vkSemaphore, (uint64_t*)&value);
+
+		if (result)
+			throw Exception("Failed to get semaphore value.", this, (Exception::Type)result);
+
+		return value;
+	}
+
+	void Semaphore::Signal(ACTL::u64 value) const {
+		VkSemaphoreSignalInfo vkInfo = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO,
+			.semaphore = vkSemaphore,
+			.value = value,
+		};
+
+		VkResult result = vkSignalSemaphore(Device, &vkInfo);
+
+		if (result)
+			throw Exception("Failed to signal semaphore.", this, (Exception::Type)result);
+	}
+
+	bool Semaphore::Wait(ACTL::u64 value, ACTL::u64 timeout) const {
+		VkSemaphoreWaitInfo vkInfo = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+			.semaphoreCount = 1,
+			.pSemaphores = &vkSemaphore,
+			.pValues = (const uint64_t*)&value,
+		};
+
+		VkResult result = vkWaitSemaphores(Device, &vkInfo, timeout);
+
+		if (result == VK_TIMEOUT)
+			return false;
+
+		if (result)
+			throw Exception("Failed to wait for semaphore.", this, (Exception::Type)result);
+
+		return true;
+	}
+
+	int Semaphore::ExportFd(HandleType handleType) const {
+		auto vkGetSemaphoreFdKHR = Device.getFunctions().vkGetSemaphoreFdKHR;
+
+		if (!vkGetSemaphoreFdKHR)
+			throw Exception("VK_KHR_external_semaphore_fd is not enabled.", this, Exception::Type::EXTENSION_NOT_PRESENT);
+
+		VkSemaphoreGetFdInfoKHR vkInfo = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR,
+			.semaphore = vkSemaphore,
+			.handleType = (VkExternalSemaphoreHandleTypeFlagBits)handleType,
+		};
+
+		int fd = -1;
+
+		VkResult result = vkGetSemaphoreFdKHR(Device, &vkInfo, &fd);
+
+		if (result)
+			throw Exception("Failed to export semaphore.", this, (Exception::Type)result);
+
+		return fd;
+	}
+
+	void Semaphore::Init(ACTL::u64 initialValue, HandleType exportTypes) {
+		if (type == Type::TIMELINE && !Device.getFeatures().timelineSemaphore)
+			throw Exception("timelineSemaphore feature is not enabled.", this, Exception::Type::FEATURE_NOT_PRESENT);
+
+		VkExportSemaphoreCreateInfo vkExportInfo = {
+			.sType = VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO,
+			.handleTypes = (VkExternalSemaphoreHandleTypeFlags)exportTypes,
+		};
+
+		VkSemaphoreTypeCreateInfo vkTypeInfo = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+			.pNext = exportTypes ? &vkExportInfo : nullptr,
+			.semaphoreType = (VkSemaphoreType)type,
+			.initialValue = initialValue,
+		};
+
+		// The type structure is only chained for timelines, devices without timeline semaphores do not accept it.
 		VkSemaphoreCreateInfo vkInfo = {
 			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+			.pNext = type == Type::TIMELINE ? (const void*)&vkTypeInfo : vkTypeInfo.pNext,
 		};
 
 		VkResult result = vkCreateSemaphore(Device, &vkInfo, nullptr, &vkSemaphore);
@@ -33,12 +262,50 @@ namespace SOV {
 			throw Exception("Failed to create semaphore.", this, (Exception::Type)result);
 	}
 
-	Semaphore::~Semaphore() {
-		if (!vkSemaphore)
+	Event::~Event() {
+		if (!vkEvent)
 			return;
 
-		vkDestroySemaphore(Device, vkSemaphore, nullptr);
+		vkDestroyEvent(Device, vkEvent, nullptr);
 
-		vkSemaphore = nullptr;
+		vkEvent = nullptr;
+	}
+
+	void Event::Set() const {
+		VkResult result = vkSetEvent(Device, vkEvent);
+
+		if (result)
+			throw Exception("Failed to set event.", this, (Exception::Type)result);
+	}
+
+	void Event::Reset() const {
+		VkResult result = vkResetEvent(Device, vkEvent);
+
+		if (result)
+			throw Exception("Failed to reset event.", this, (Exception::Type)result);
+	}
+
+	bool Event::GetStatus() const {
+		VkResult result = vkGetEventStatus(Device, vkEvent);
+
+		if (result == VK_EVENT_SET)
+			return true;
+
+		if (result == VK_EVENT_RESET)
+			return false;
+
+		throw Exception("Failed to get event status.", this, (Exception::Type)result);
+	}
+
+	void Event::Init(Flag flags) {
+		VkEventCreateInfo vkInfo = {
+			.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO,
+			.flags = (VkEventCreateFlags)flags,
+		};
+
+		VkResult result = vkCreateEvent(Device, &vkInfo, nullptr, &vkEvent);
+
+		if (result)
+			throw Exception("Failed to create event.", this, (Exception::Type)result);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "Source.hpp"
+
+namespace SOV {
+	namespace Descriptor {
+		void Writer::WriteBuffer(const Set& Set, unsigned binding, unsigned arrayElement, Type type, const Buffer& Buffer, SOV::size offset, SOV::size range) {
+			bufferInfos.EmplaceBack(VkDescriptorBufferInfo{
+				.buffer = Buffer,
+				.offset = offset,
+				.range = range,
+			});
+
+			Add(Set, binding, arrayElement, type, false);
+		}
+
+		void Writer::WriteImage(const Set& Set, unsigned binding, unsigned arrayElement, Type type, const Image::View& View, Image::Layout layout) {
+			imageInfos.EmplaceBack(VkDescriptorImageInfo{
+				.imageView = View,
+				.imageLayout = (VkImageLayout)layout,
+			});
+
+			Add(Set, binding, arrayElement, type, true);
+		}
+
+		void Writer::WriteImage(const Set& Set, unsigned binding, unsigned arrayElement, const Image::View& View, Image::Layout layout, const Sampler& Sampler) {
+			imageInfos.EmplaceBack(VkDescriptorImageInfo{
+				.sampler = Sampler,
+				.imageView = View,
+				.imageLayout = (VkImageLayout)layout,
+			});
+
+			Add(Set, binding, arrayElement, Type::COMBINED_IMAGE_SAMPLER, true);
+		}
+
+		void Writer::WriteSampler(const Set& Set, unsigned binding, unsigned arrayElement, const Sampler& Sampler) {
+			imageInfos.EmplaceBack(VkDescriptorImageInfo{
+				.sampler = Sampler,
+			});
+
+			Add(Set, binding, arrayElement, Type::SAMPLER, true);
+		}
+
+		void Writer::Flush() {
+			if (writes.isEmpty())
+				return;
+
+			SetInfoPointers();
+
+			vkUpdateDescriptorSets(Device, (unsigned)writes.GetLength(), writes.begin(), 0, nullptr);
+
+			Clear();
+		}
+
+		void Writer::Push(const Command::Buffer& Buffer, Pipeline::BindPoint bindPoint, VkPipelineLayout vkLayout, unsigned set) {
+			if (writes.isEmpty())
+				return;
+
+			SetInfoPointers();
+
+			Buffer.PushDescriptorSet(Device, bindPoint, vkLayout, set, (unsigned)writes.GetLength(), writes.begin());
+
+			Clear();
+		}
+
+		void Writer::SetInfoPointers() {
+			// Infos may have moved while growing, so pointers are set only now.
+			for (unsigned i = 0; i < writes.GetLength(); i++)
+				if (infos[i].image)
+					writes[i].pImageInfo = imageInfos.begin() + infos[i].index;
+				else
+					writes[i].pBufferInfo = bufferInfos.begin() + infos[i].index;
+		}
+
+		void Writer::Clear() {
+			writes.Clear();
+
+			infos.Clear();
+
+			bufferInfos.Clear();
+
+			imageInfos.Clear();
+		}
+
+		void Writer::Add(VkDescriptorSet vkSet, unsigned binding, unsigned arrayElement, Type type, bool image) {
+			const unsigned index = (unsigned)(image ? imageInfos.GetLength() : bufferInfos.GetLength()) - 1;
+
+			// Infos of the last write are the last ones of their kind, so the new one follows them.
+			if (!writes.isEmpty()) {
+				VkWriteDescriptorSet& last = writes[writes.GetLength() - 1];
+
+				if (last.dstSet == vkSet &&
+					last.dstBinding == binding &&
+					last.descriptorType == (VkDescriptorType)type &&
+					last.dstArrayElement + last.descriptorCount == arrayElement) {
+					last.descriptorCount++;
+
+					return;
+				}
+			}
+
+			writes.EmplaceBack(VkWriteDescriptorSet{
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.dstSet = vkSet,
+				.dstBinding = binding,
+				.dstArrayElement = arrayElement,
+				.descriptorCount = 1,
+				.descriptorType = (VkDescriptorType)type,
+			});
+
+			infos.EmplaceBack(Info{ index, image });
+		}
+	}
+}
\ No newline at end of file